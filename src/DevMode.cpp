@@ -1,7 +1,9 @@
 #include "./DevMode.hpp"
+#include "./resources/FontService.hpp"
 #include <sstream>
 #include <iostream>
 #include <array>
+#include <algorithm>
 
 /**
  * @brief Construct a new Dev Mode:: Dev Mode object
@@ -10,19 +12,19 @@
  */
 DevMode::DevMode(bool active) : active(active)
 {
-    if (!font.loadFromFile("../src/assets/fonts/RobotoMono-Regular.ttf"))
-    {
-        std::cerr << "Impossible de charger la police pour DevMode\n";
-        fontLoaded = false;
-    }
+    fontLoaded = FontService::isLoaded();
+    if (fontLoaded)
+        text.setFont(FontService::getFont());
     else
-    {
-        fontLoaded = true;
-        text.setFont(font);
-    }
+        std::cerr << "Impossible de charger la police pour DevMode\n";
     text.setCharacterSize(14);
     text.setFillColor(sf::Color::Red);
     text.setPosition(10.f, 10.f);
+
+    if (fontLoaded)
+        profilerText.setFont(FontService::getFont());
+    profilerText.setCharacterSize(14);
+    profilerText.setFillColor(sf::Color::White);
 }
 
 /**
@@ -32,7 +34,7 @@ DevMode::DevMode(bool active) : active(active)
  * @param player Le personnage joueur dont on affiche les infos.
  * @param allCharacters Tous les personnages du jeu pour afficher leurs HP.
  */
-void DevMode::drawInfo(sf::RenderWindow &window, const GameCharacter &player, std::vector<GameCharacter *> allCharacters)
+void DevMode::drawInfo(sf::RenderWindow &window, const GameCharacter &player, const std::vector<GameCharacter *>& allCharacters)
 {
     if (!active)
         return;
@@ -43,6 +45,7 @@ void DevMode::drawInfo(sf::RenderWindow &window, const GameCharacter &player, st
     ss << "On Ground: " << (player.isOnGround() ? "YES" : "NO") << "\n";
     ss << "HP: " << player.getHp() << " / " << player.getMaxHp() << "\n";
     ss << "Mana: " << player.getMana() << " / " << player.getMaxMana() << "\n";
+    ss << "Culling: " << cullingStats.drawn << " drawn / " << cullingStats.culled << " culled\n";
     for (auto character : allCharacters) {
         ss << character->getName() << " : " << character->getHp() << " (force=" << character->getForce() << ")\n";
     }    
@@ -54,7 +57,7 @@ void DevMode::drawInfo(sf::RenderWindow &window, const GameCharacter &player, st
     }
 }
 
-void DevMode::drawDebugOverlays(sf::RenderWindow &window, const GameCharacter &player, const std::vector<std::unique_ptr<Ground>>& grounds, std::vector<GameCharacter *> allCharacters)
+void DevMode::drawDebugOverlays(sf::RenderWindow &window, const GameCharacter &player, const std::vector<std::unique_ptr<Ground>>& grounds, const std::vector<GameCharacter *>& allCharacters)
 {
     if (!active) return;
 
@@ -119,6 +122,129 @@ void DevMode::drawDebugOverlays(sf::RenderWindow &window, const GameCharacter &p
     }
 }
 
+/**
+ * @brief Range la latence entrée -> affichage d'une frame (affichée par drawProfiler).
+ *
+ * @param milliseconds Du premier événement clavier du tick à la fin du display() qui le montre.
+ */
+void DevMode::addInputLatency(float milliseconds)
+{
+    inputLatencies[inputLatencyHead] = milliseconds;
+    inputLatencyHead = (inputLatencyHead + 1) % inputLatencies.size();
+    inputLatencyCount = std::min(inputLatencyCount + 1, inputLatencies.size());
+}
+
+/**
+ * @brief Dessine le graphe des dernières frames et le temps moyen de chaque étape.
+ *
+ * Une barre par frame (verte sous 16,7 ms, jaune sous 33,3 ms, rouge au-delà), en haut à droite.
+ * Sous le détail, la latence entrée -> affichage des dernières frames ayant reçu une touche.
+ *
+ * @param target La cible, en vue par défaut.
+ */
+void DevMode::drawProfiler(sf::RenderTarget &target)
+{
+    if (!active)
+        return;
+
+    constexpr std::size_t graphFrames = 240;
+    constexpr float barWidth = 2.f;
+    constexpr float graphHeight = 120.f;
+    constexpr float graphMaxMs = 50.f;
+    constexpr float margin = 10.f;
+
+    const FrameProfiler &profiler = FrameProfiler::getInstance();
+    const std::size_t count = profiler.copyRecent(profilerFrames, graphFrames);
+
+    const float left = static_cast<float>(target.getSize().x) - graphFrames * barWidth - margin;
+    const float bottom = margin + graphHeight;
+
+    // Fond du graphe et repère à 16,7 ms
+    sf::RectangleShape frame(sf::Vector2f(graphFrames * barWidth, graphHeight));
+    frame.setPosition(left, margin);
+    frame.setFillColor(sf::Color(0, 0, 0, 160));
+    target.draw(frame);
+
+    sf::RectangleShape budget(sf::Vector2f(graphFrames * barWidth, 1.f));
+    budget.setPosition(left, bottom - graphHeight * (1000.f / 60.f) / graphMaxMs);
+    budget.setFillColor(sf::Color(255, 255, 255, 96));
+    target.draw(budget);
+
+    profilerGraph.resize(count * 4);
+    std::array<float, FrameProfiler::StageCount> stageTotals{};
+    std::array<std::uint64_t, FrameProfiler::StageCount + 1> allocationTotals{};
+    float frameTotal = 0.f;
+    float frameWorst = 0.f;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const FrameProfiler::Frame &f = profilerFrames[i];
+        const float height = std::min(f.frameMs, graphMaxMs) / graphMaxMs * graphHeight;
+        const float x = left + (graphFrames - count + i) * barWidth;
+        const sf::Color color = f.frameMs <= 1000.f / 60.f ? sf::Color::Green : (f.frameMs <= 1000.f / 30.f ? sf::Color::Yellow : sf::Color::Red);
+
+        sf::Vertex *quad = &profilerGraph[i * 4];
+        quad[0] = sf::Vertex(sf::Vector2f(x, bottom - height), color);
+        quad[1] = sf::Vertex(sf::Vector2f(x + barWidth, bottom - height), color);
+        quad[2] = sf::Vertex(sf::Vector2f(x + barWidth, bottom), color);
+        quad[3] = sf::Vertex(sf::Vector2f(x, bottom), color);
+
+        frameTotal += f.frameMs;
+        frameWorst = std::max(frameWorst, f.frameMs);
+        for (std::size_t s = 0; s < FrameProfiler::StageCount; ++s)
+            stageTotals[s] += f.stageMs[s];
+        for (std::size_t s = 0; s <= FrameProfiler::StageCount; ++s)
+            allocationTotals[s] += f.allocations[s];
+    }
+    target.draw(profilerGraph);
+
+    if (!fontLoaded || count == 0)
+        return;
+
+    // Le texte de l'overlay alloue : compté hors étape pour ne pas se mêler au rendu mesuré
+    const std::uint8_t previousTag = AllocationTracker::setTag(AllocationTracker::untagged);
+
+    // Détail par étape : moyennes sur les frames du graphe (temps et allocations du tas)
+    std::uint64_t allocationSum = 0;
+    for (std::uint64_t total : allocationTotals)
+        allocationSum += total;
+
+    std::stringstream ss;
+    ss.setf(std::ios::fixed);
+    ss.precision(2);
+    ss << "frame " << frameTotal / count << " ms (max " << frameWorst << ")";
+    if (AllocationTracker::isEnabled())
+        ss << ", " << static_cast<double>(allocationSum) / count << " allocs";
+    ss << "\n";
+    for (std::size_t s = 0; s < FrameProfiler::StageCount; ++s)
+    {
+        ss << FrameProfiler::getStageName(static_cast<FrameProfiler::Stage>(s)) << " " << stageTotals[s] / count << " ms";
+        if (AllocationTracker::isEnabled())
+            ss << ", " << static_cast<double>(allocationTotals[s]) / count << " allocs";
+        ss << "\n";
+    }
+    if (AllocationTracker::isEnabled())
+        ss << "other " << static_cast<double>(allocationTotals[FrameProfiler::StageCount]) / count << " allocs\n";
+    if (inputLatencyCount > 0)
+    {
+        float latencyTotal = 0.f;
+        float latencyWorst = 0.f;
+        for (std::size_t i = 0; i < inputLatencyCount; ++i)
+        {
+            latencyTotal += inputLatencies[i];
+            latencyWorst = std::max(latencyWorst, inputLatencies[i]);
+        }
+        const std::size_t last = (inputLatencyHead + inputLatencies.size() - 1) % inputLatencies.size();
+        ss << "input->photon " << inputLatencies[last] << " ms (avg " << latencyTotal / inputLatencyCount << ", max " << latencyWorst << ")\n";
+    }
+    ss << "F9: export CSV";
+
+    profilerText.setString(ss.str());
+    profilerText.setPosition(left, bottom + 4.f);
+    target.draw(profilerText);
+
+    AllocationTracker::setTag(previousTag);
+}
+
 /**
  * @brief Active ou désactive le mode développeur.
  */
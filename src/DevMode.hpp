@@ -1,6 +1,9 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "characters/GameCharacter.hpp"
+#include "environnement/VisibilityGrid.hpp"
+#include "profiling/FrameProfiler.hpp"
+#include <array>
 #include <string>
 
 class DevMode {
@@ -8,10 +11,19 @@ public:
     explicit DevMode(bool active = true);
 
     // Affiche les infos du joueur
-    void drawInfo(sf::RenderWindow& window, const GameCharacter& player, std::vector<GameCharacter *> allCharacters);
+    void drawInfo(sf::RenderWindow& window, const GameCharacter& player, const std::vector<GameCharacter *>& allCharacters);
 
     // Dessine des overlays de debug (hitboxes, bounds des grounds)
-    void drawDebugOverlays(sf::RenderWindow& window, const GameCharacter& player, const std::vector<std::unique_ptr<Ground>>& grounds, std::vector<GameCharacter *> allCharacters);
+    void drawDebugOverlays(sf::RenderWindow& window, const GameCharacter& player, const std::vector<std::unique_ptr<Ground>>& grounds, const std::vector<GameCharacter *>& allCharacters);
+
+    // Compteurs du culling de la dernière frame
+    void setCullingStats(const CullingStats& stats) { cullingStats = stats; }
+
+    // Latence d'une frame entre le premier événement clavier du tick et la fin de son display() (thread de rendu)
+    void addInputLatency(float milliseconds);
+
+    // Graphe des temps de frame et détail par étape (voir FrameProfiler)
+    void drawProfiler(sf::RenderTarget& target);
 
     // Activer / désactiver le mode dev
     void setActive(bool active);
@@ -21,10 +33,21 @@ private:
     bool active;
 
     // Pour dessiner du texte
-    sf::Font font;
     sf::Text text;
     bool fontLoaded = false;
 
+    CullingStats cullingStats;
+
+    // Dernières latences entrée -> affichage (anneau)
+    std::array<float, 64> inputLatencies{};
+    std::size_t inputLatencyHead = 0;
+    std::size_t inputLatencyCount = 0;
+
+    // Profiler : dernières frames et barres du graphe (réutilisées d'une frame à l'autre)
+    std::vector<FrameProfiler::Frame> profilerFrames;
+    sf::VertexArray profilerGraph{sf::Quads};
+    sf::Text profilerText;
+
     // Formatage pratique
     std::string formatVector(const sf::Vector2f& v) const;
 };
\ No newline at end of file
@@ -15,7 +15,7 @@ class Block
 {
 public:
     virtual ~Block() = default;
-    virtual void draw(sf::RenderWindow& window, int x, int y, int cellSize) = 0;
+    virtual void draw(sf::RenderTarget& target, int x, int y, int cellSize) = 0;
     // Retourne les Ground associés à ce Block. Par convention la méthode
     // retourne un vecteur par valeur et transfère la propriété des Grounds
     // appelant (via std::move) si nécessaire.
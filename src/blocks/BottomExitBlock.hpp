@@ -5,7 +5,7 @@
 
 class BottomExitBlock : public ExitBlock {
 public:
-    BottomExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(BOTTOM_EXIT, posx, posy, window) {}
+    BottomExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(BOTTOM_EXIT, posx, posy, areaSize) {}
 };
 
 #endif
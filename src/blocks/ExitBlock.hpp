@@ -10,24 +10,29 @@
 
 class ExitBlock : public Block {
 public:
-    ExitBlock(BlockType type, int posx, int posy, sf::RenderWindow& window);
+    /**
+     * @param areaSize Taille de la zone couverte par GRID_COLS x GRID_ROWS blocs (la fenêtre en jeu)
+     */
+    ExitBlock(BlockType type, int posx, int posy, const sf::Vector2u& areaSize);
 
-    void draw(sf::RenderWindow& window, int x, int y, int cellSize) override;
+    void draw(sf::RenderTarget& target, int x, int y, int cellSize) override;
     std::vector<std::unique_ptr<Ground>> createGrounds() override;
     std::vector<std::unique_ptr<Object>> createObjects() override;
     std::vector<std::unique_ptr<GameCharacter>> createCharacters() override;
 
+    // Nombre de blocs couverts par la fenêtre (taille d'un bloc = taille fenêtre / GRID)
+    static constexpr int GRID_COLS = 7;
+    static constexpr int GRID_ROWS = 4;
+
 protected:
     // construit les grounds en fonction du mask
-    std::vector<std::unique_ptr<Ground>> buildGrounds(BlockType mask, int posx, int posy, sf::RenderWindow& window);
+    std::vector<std::unique_ptr<Ground>> buildGrounds(BlockType mask, int posx, int posy);
 
     BlockType mask_;
     int posx_;
     int posy_;
     std::vector<std::unique_ptr<Ground>> grounds_;
-    sf::RenderWindow* window_;
-    static constexpr int GRID_COLS = 7;
-    static constexpr int GRID_ROWS = 4;
+    sf::Vector2u areaSize_;
     static constexpr float CHEST_SPAWN_CHANCE = 20.f;  // 20% de chance
     static constexpr float CANDLE_SPAWN_CHANCE = 30.f;    // 30% de chance
 };
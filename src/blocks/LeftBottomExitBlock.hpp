@@ -5,7 +5,7 @@
 
 class LeftBottomExitBlock : public ExitBlock {
 public:
-    LeftBottomExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | BOTTOM_EXIT), posx, posy, window) {}
+    LeftBottomExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | BOTTOM_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
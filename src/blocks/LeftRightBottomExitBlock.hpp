@@ -5,7 +5,7 @@
 
 class LeftRightBottomExitBlock : public ExitBlock {
 public:
-    LeftRightBottomExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | RIGHT_EXIT | BOTTOM_EXIT), posx, posy, window) {}
+    LeftRightBottomExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | RIGHT_EXIT | BOTTOM_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
@@ -5,7 +5,7 @@
 
 class LeftRightExitBlock : public ExitBlock {
 public:
-    LeftRightExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | RIGHT_EXIT), posx, posy, window) {}
+    LeftRightExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | RIGHT_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
@@ -5,7 +5,7 @@
 
 class LeftTopBottomExitBlock : public ExitBlock {
 public:
-    LeftTopBottomExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | TOP_EXIT | BOTTOM_EXIT), posx, posy, window) {}
+    LeftTopBottomExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | TOP_EXIT | BOTTOM_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
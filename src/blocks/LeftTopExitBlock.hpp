@@ -5,7 +5,7 @@
 
 class LeftTopExitBlock : public ExitBlock {
 public:
-    LeftTopExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | TOP_EXIT), posx, posy, window) {}
+    LeftTopExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | TOP_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
@@ -5,7 +5,7 @@
 
 class LeftTopRightExitBlock : public ExitBlock {
 public:
-    LeftTopRightExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | TOP_EXIT | RIGHT_EXIT), posx, posy, window) {}
+    LeftTopRightExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(LEFT_EXIT | TOP_EXIT | RIGHT_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
@@ -5,7 +5,7 @@
 
 class RightBottomExitBlock : public ExitBlock {
 public:
-    RightBottomExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(RIGHT_EXIT | BOTTOM_EXIT), posx, posy, window) {}
+    RightBottomExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(RIGHT_EXIT | BOTTOM_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
@@ -5,7 +5,7 @@
 
 class RightExitBlock : public ExitBlock {
 public:
-    RightExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(RIGHT_EXIT, posx, posy, window) {}
+    RightExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(RIGHT_EXIT, posx, posy, areaSize) {}
 };
 
 #endif
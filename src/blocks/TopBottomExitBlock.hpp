@@ -5,7 +5,7 @@
 
 class TopBottomExitBlock : public ExitBlock {
 public:
-    TopBottomExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(TOP_EXIT | BOTTOM_EXIT), posx, posy, window) {}
+    TopBottomExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(TOP_EXIT | BOTTOM_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
@@ -5,7 +5,7 @@
 
 class TopExitBlock : public ExitBlock {
 public:
-    TopExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(TOP_EXIT, posx, posy, window) {}
+    TopExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(TOP_EXIT, posx, posy, areaSize) {}
 };
 
 #endif
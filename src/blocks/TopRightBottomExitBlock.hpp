@@ -5,7 +5,7 @@
 
 class TopRightBottomExitBlock : public ExitBlock {
 public:
-    TopRightBottomExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(TOP_EXIT | RIGHT_EXIT | BOTTOM_EXIT), posx, posy, window) {}
+    TopRightBottomExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(TOP_EXIT | RIGHT_EXIT | BOTTOM_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
@@ -5,7 +5,7 @@
 
 class TopRightExitBlock : public ExitBlock {
 public:
-    TopRightExitBlock(int posx, int posy, sf::RenderWindow& window) : ExitBlock(static_cast<BlockType>(TOP_EXIT | RIGHT_EXIT), posx, posy, window) {}
+    TopRightExitBlock(int posx, int posy, const sf::Vector2u& areaSize) : ExitBlock(static_cast<BlockType>(TOP_EXIT | RIGHT_EXIT), posx, posy, areaSize) {}
 };
 
 #endif
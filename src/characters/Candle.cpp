@@ -1,5 +1,6 @@
 #include "Candle.hpp"
 #include "Player.hpp"
+#include "../events/CommandBuffer.hpp"
 #include <cmath>
 #include <iostream>
 
@@ -30,9 +31,10 @@ sf::Vector2f Candle::calculateDirectionToPlayer(const sf::Vector2f& playerPos)
 
 /**
  * @brief Met à jour le comportement de la chandelle
- * Poursuite du joueur si celui-ci est dans la zone de détection
+ * Poursuite du joueur si celui-ci est dans la zone de détection ; la gravité et les collisions
+ * sont appliquées ensuite par GameLevel::step, après l'exécution des commandes
  */
-void Candle::updateBehavior(float deltaTime, Player* player, const std::vector<std::unique_ptr<Ground>>& grounds)
+void Candle::updateBehavior(float deltaTime, Player* player, const std::vector<std::unique_ptr<Ground>>& grounds, CommandBuffer& commands)
 {
     if (player == nullptr || !player->isAlive())
         return;
@@ -60,11 +62,8 @@ void Candle::updateBehavior(float deltaTime, Player* player, const std::vector<s
         sf::Vector2f velocity = this->getVelocity();
         velocity.x = direction.x * this->getSpeed();
         
-        // Met à jour la position en appliquant les forces et collisions
-        this->move(sf::Vector2f(velocity.x * deltaTime, 0.f));
-        
-        // Appliquer la gravité et les collisions
-        this->update(deltaTime, grounds);
+        // Déplacement horizontal du tick
+        commands.push(Command::move(*this, sf::Vector2f(velocity.x * deltaTime, 0.f)));
         
         // Vérifier si le joueur est en portée d'attaque et si le cooldown est écoulé
         if (distance <= attackRange && attackCooldown <= 0.f)
@@ -72,18 +71,12 @@ void Candle::updateBehavior(float deltaTime, Player* player, const std::vector<s
             // Déterminer la direction d'attaque (gauche ou droite)
             Direction attackDirection = (direction.x < 0.f) ? Direction::Left : Direction::Right;
             
-            // Effectuer l'attaque avec les paramètres définis
-            this->attack(attackDirection, {player}, AttackType::CandleAttack, grounds);
+            // Attaque du joueur seul, avec les paramètres définis
+            commands.push(Command::attack(*this, attackDirection, AttackType::CandleAttack, player));
             
             // Réinitialiser le cooldown
             attackCooldown = attackCooldownDuration;
         }
     }
-    else
-    {
-        // Comportement inactif si joueur non détecté
-        sf::Vector2f velocity = this->getVelocity();
-        velocity.x = 0.f;
-        this->update(deltaTime, grounds);
-    }
+    // Sinon : comportement inactif si joueur non détecté (aucune commande)
 }
@@ -30,7 +30,8 @@ public:
      * @brief Met à jour le comportement de la chandelle (poursuite du joueur)
      * @param deltaTime Temps écoulé depuis le dernier update
      * @param player Pointeur sur le joueur
-     * @param grounds Vecteur des terrains pour les collisions
+     * @param grounds Vecteur des terrains pour la ligne de vue
+     * @param commands Tampon recevant le déplacement et l'attaque de la chandelle
      */
-    void updateBehavior(float deltaTime, Player* player, const std::vector<std::unique_ptr<Ground>>& grounds);
+    void updateBehavior(float deltaTime, Player* player, const std::vector<std::unique_ptr<Ground>>& grounds, CommandBuffer& commands) override;
 };
@@ -1,5 +1,7 @@
 #include "GameCharacter.hpp"
-#include "../ui/CameraShake.hpp"
+#include "../events/GameplayEventBus.hpp"
+#include "../rendering/SpriteBatch.hpp"
+#include "../profiling/FrameProfiler.hpp"
 #include <iostream>
 #include <array>
 #include <memory>
@@ -21,9 +23,6 @@ GameCharacter::GameCharacter(const std::string &name, int hp, int mana, int stam
       endurance(stamina), maxEndurance(stamina),speed(speed), position(0.f, 0.f), velocity(0.f, 0.f),
       texture(std::move(texture)), previousPosition(0.f, 0.f)
 {
-    if (!flashShader.loadFromMemory(FlashShaderCode, sf::Shader::Fragment)) {
-        std::cerr << "Failed to load flash shader from memory!" << std::endl;
-    }
     sprite.setTexture(*this->texture);
     sprite.setPosition(position);
 
@@ -39,6 +38,8 @@ GameCharacter::GameCharacter(const std::string &name, int hp, int mana, int stam
  */
 void GameCharacter::update(float deltaTime, const std::vector<std::unique_ptr<Ground>> &grounds)
 {
+    PROFILE_SCOPE(Physics);
+
     // Réinitialiser les états de contact
     collisionsToZero();
 
@@ -505,18 +506,18 @@ void GameCharacter::selfAnimator(float deltaTime)
 
         // Calculer l'IntRect final
         sf::IntRect rect;
-        rect.top = 0;
+        rect.top = frameOrigin.y;
         rect.height = frameHeight;
 
         // Si on est en Idle et qu'on fait face à gauche, retourner le sprite
         if (currentState == AnimationState::Idle && facingLeft)
         {
-            rect.left = (currentFrame + 1) * frameWidth;
+            rect.left = frameOrigin.x + (currentFrame + 1) * frameWidth;
             rect.width = -frameWidth; // flip horizontal
         }
         else
         {
-            rect.left = currentFrame * frameWidth;
+            rect.left = frameOrigin.x + currentFrame * frameWidth;
             rect.width = frameWidth;
         }
 
@@ -578,14 +579,18 @@ void GameCharacter::attackAnimator(float deltaTime, Direction direction)
 }
 
 /**
- * @brief Définit la texture d'animation pour un état donné.
+ * @brief Définit la planche d'animation pour un état donné.
  *
  * @param state L'état d'animation (Idle, WalkLeft, WalkRight, etc.)
- * @param texture La texture associée à cet état
+ * @param region La région de l'atlas contenant la planche (frames alignées horizontalement)
+ *
+ * @note Si l'état est l'état courant, la planche est appliquée immédiatement.
  */
-void GameCharacter::setAnimationTexture(AnimationState state, std::shared_ptr<sf::Texture> texture, int frameCount, int frameWidth, int frameHeight, float fps)
+void GameCharacter::setAnimationTexture(AnimationState state, const AtlasRegion &region, int frameCount, int frameWidth, int frameHeight, float fps)
 {
-    animations[state] = {texture, frameCount, frameWidth, frameHeight, 1.f / fps};
+    animations[state] = {region.texture, sf::Vector2i(region.rect.left, region.rect.top), frameCount, frameWidth, frameHeight, 1.f / fps};
+    if (currentState == state)
+        applyAnimation(state);
 }
 
 /**
@@ -598,44 +603,55 @@ void GameCharacter::setAnimationState(AnimationState newState)
     if (currentState != newState)
     {
         currentState = newState;
-        auto it = animations.find(newState);
-        if (it != animations.end())
-        {
-            const auto &anim = it->second;
-            sprite.setTexture(*anim.texture);
-            frameCount = anim.frameCount;
-            frameWidth = anim.frameWidth;
-            frameHeight = anim.frameHeight;
-            frameTime = anim.frameTime;
-            currentFrame = 0;
-            timer = 0.f;
-            sprite.setTextureRect(sf::IntRect(0, 0, frameWidth, frameHeight));
-            // Update hitbox for this animation if a specific one exists, otherwise use default
-            auto hitIt = animationHitboxesRaw.find(newState);
-            sf::FloatRect raw;
-            if (hitIt != animationHitboxesRaw.end())
-            {
-                raw = hitIt->second;
-            }
-            else
-            {
-                raw = defaultHitboxRaw;
-            }
-            // apply current sprite scale
-            float scaleX = sprite.getScale().x;
-            float scaleY = sprite.getScale().y;
-            hitbox = sf::FloatRect(raw.left * scaleX, raw.top * scaleY, raw.width * scaleX, raw.height * scaleY);
-            // Update sprite offset for this animation
-            auto offsetIt = animationSpriteOffsetsRaw.find(newState);
-            if (offsetIt != animationSpriteOffsetsRaw.end())
-            {
-                currentSpriteOffset = offsetIt->second * sprite.getScale().x; // scale offset by sprite scale
-            }
-            else
-            {
-                currentSpriteOffset = {0.f, 0.f};
-            }
-        }
+        applyAnimation(newState);
+    }
+}
+
+/**
+ * @brief Applique au sprite la planche, la hitbox et l'offset de l'animation donnée (si elle est définie).
+ *
+ * @param state L'état d'animation à appliquer.
+ */
+void GameCharacter::applyAnimation(AnimationState state)
+{
+    auto it = animations.find(state);
+    if (it == animations.end())
+        return;
+
+    const auto &anim = it->second;
+    sprite.setTexture(*anim.texture);
+    frameOrigin = anim.origin;
+    frameCount = anim.frameCount;
+    frameWidth = anim.frameWidth;
+    frameHeight = anim.frameHeight;
+    frameTime = anim.frameTime;
+    currentFrame = 0;
+    timer = 0.f;
+    sprite.setTextureRect(sf::IntRect(frameOrigin.x, frameOrigin.y, frameWidth, frameHeight));
+    // Update hitbox for this animation if a specific one exists, otherwise use default
+    auto hitIt = animationHitboxesRaw.find(state);
+    sf::FloatRect raw;
+    if (hitIt != animationHitboxesRaw.end())
+    {
+        raw = hitIt->second;
+    }
+    else
+    {
+        raw = defaultHitboxRaw;
+    }
+    // apply current sprite scale
+    float scaleX = sprite.getScale().x;
+    float scaleY = sprite.getScale().y;
+    hitbox = sf::FloatRect(raw.left * scaleX, raw.top * scaleY, raw.width * scaleX, raw.height * scaleY);
+    // Update sprite offset for this animation
+    auto offsetIt = animationSpriteOffsetsRaw.find(state);
+    if (offsetIt != animationSpriteOffsetsRaw.end())
+    {
+        currentSpriteOffset = offsetIt->second * sprite.getScale().x; // scale offset by sprite scale
+    }
+    else
+    {
+        currentSpriteOffset = {0.f, 0.f};
     }
 }
 
@@ -664,23 +680,43 @@ void GameCharacter::setAnimationSpriteOffset(AnimationState state, float offsetX
 /**
  * @brief Dessine le personnage
  *
- * @param window La fenetre ou on veut dessiner le personnage
+ * @param target La cible de rendu (fenêtre ou texture)
  */
-void GameCharacter::draw(sf::RenderWindow &window)
+void GameCharacter::draw(sf::RenderTarget &target)
 {
-    // Apply sprite offset for rendering
-    sf::Vector2f originalPos = sprite.getPosition();
-    sprite.setPosition(originalPos + currentSpriteOffset);
-    // If damaged, use flash shader
-    if (isDamaged && damageTimer > 0.f)
-    {
-        window.draw(sprite, &flashShader);
-    }
-    else
-    {
-        window.draw(sprite);
-    }
-    sprite.setPosition(originalPos);
+    // Chemin de debug hors lot : le shader du flash appartient au rendu, le flash n'apparaît pas ici
+    sf::Transform offset;
+    offset.translate(currentSpriteOffset);
+    target.draw(sprite, offset);
+}
+
+/**
+ * @brief Ajoute le personnage au lot de sprites de la frame
+ *
+ * @param batch Le lot de sprites
+ */
+void GameCharacter::submit(SpriteBatch &batch) const
+{
+    batch.submit(sprite, getDrawTransform(), SpriteBatch::Characters, getFlashAmount());
+}
+
+/**
+ * @brief Transformation du sprite, décalage d'animation compris
+ */
+sf::Transform GameCharacter::getDrawTransform() const
+{
+    sf::Transform transform;
+    transform.translate(currentSpriteOffset);
+    transform.combine(sprite.getTransform());
+    return transform;
+}
+
+/**
+ * @brief Niveau de flash de dégâts à appliquer (0 hors période de dégâts)
+ */
+float GameCharacter::getFlashAmount() const
+{
+    return (isDamaged && damageTimer > 0.f) ? flashAlpha : 0.f;
 }
 
 /**
@@ -690,14 +726,16 @@ void GameCharacter::draw(sf::RenderWindow &window)
  * @param width La largeur d'une frame
  * @param height La hauteur d'une frame
  * @param fps Le nombre de frames par seconde
+ * @param origin Le coin haut-gauche de la planche dans la texture (région de l'atlas)
  */
-void GameCharacter::setAnimationParams(int count, int width, int height, float fps)
+void GameCharacter::setAnimationParams(int count, int width, int height, float fps, const sf::Vector2i &origin)
 {
     frameCount = count;
     frameWidth = width;
     frameHeight = height;
     frameTime = 1.f / fps;
-    sprite.setTextureRect(sf::IntRect(0, 0, width, height));
+    frameOrigin = origin;
+    sprite.setTextureRect(sf::IntRect(origin.x, origin.y, width, height));
 }
 
 //--------------------------------------------------------------------------------------
@@ -710,13 +748,13 @@ void GameCharacter::setAnimationParams(int count, int width, int height, float f
  * @param dir La direction de l'attaque (gauche ou droite).
  * @param targets Un vecteur de pointeurs vers les cibles potentielles.
  */
-void GameCharacter::attack(Direction dir, std::vector<GameCharacter *> targets, const std::vector<std::unique_ptr<Ground>> &grounds)
+void GameCharacter::attack(Direction dir, const std::vector<GameCharacter *> &targets, const std::vector<std::unique_ptr<Ground>> &grounds)
 {
     // default to SwordAttack for backward compatibility
     attack(dir, targets, AttackType::SwordAttack, grounds);
 }
 
-void GameCharacter::attack(Direction dir, std::vector<GameCharacter *> targets, AttackType type, const std::vector<std::unique_ptr<Ground>> &grounds)
+void GameCharacter::attack(Direction dir, const std::vector<GameCharacter *> &targets, AttackType type, const std::vector<std::unique_ptr<Ground>> &grounds)
 {
     // cannot attack while stunned
     if (isStunned)
@@ -753,11 +791,8 @@ void GameCharacter::attack(Direction dir, std::vector<GameCharacter *> targets,
 
     attackAnimator(0.f, dir);
 
-    // Trigger camera shake on attack with the attack delay
-    if (cameraShake != nullptr)
-    {
-        cameraShake->trigger(0.15f, 4.f, 15.f, delay); // duration, intensity, frequency, delay
-    }
+    // La caméra (entre autres) réagit à l'attaque via le bus, après le délai
+    GameplayEventBus::getInstance().publish(AttackStarted{this, delay});
 
     // Créer une hitbox pour l'attaque en fonction du type
     sf::FloatRect attackBox;
@@ -802,6 +837,7 @@ void GameCharacter::attack(Direction dir, std::vector<GameCharacter *> targets,
  */
 void GameCharacter::takeDamage(int dmg)
 {
+    const bool wasAlive = isAlive();
     hp -= dmg;
     if (hp < 0)
         hp = 0;
@@ -811,12 +847,12 @@ void GameCharacter::takeDamage(int dmg)
     isStunned = true;
     stunTimer = stunDuration;
     // sprite color will be updated in update() based on damageTimer
-    
-    // Trigger camera shake on damage
-    if (cameraShake != nullptr)
-    {
-        cameraShake->trigger(0.3f, 8.f, 12.f); // duration, intensity, frequency
-    }
+
+    // Tremblement de caméra, télémétrie... : abonnés du bus
+    GameplayEventBus &events = GameplayEventBus::getInstance();
+    events.publish(DamageDealt{this, dmg, hp, position});
+    if (wasAlive && !isAlive())
+        events.publish(CharacterDied{this, position});
 }
 
 bool GameCharacter::consumeStamina(int cost)
@@ -947,12 +983,12 @@ void GameCharacter::allCooldowns(float deltaTime)
     if (damageTimer > 0.f)
     {
         damageTimer -= deltaTime;
-        float alpha = (static_cast<int>(damageTimer * 15.f) % 2 == 0) ? 1.0f : 0.0f;
-        flashShader.setUniform("flashAlpha", alpha);
+        flashAlpha = (static_cast<int>(damageTimer * 15.f) % 2 == 0) ? 1.0f : 0.0f;
     }
     else
     {
         isDamaged = false;
+        flashAlpha = 0.f;
         sprite.setColor(sf::Color(255, 255, 255));
     }
 }
@@ -1188,6 +1224,7 @@ bool GameCharacter::useItem(int slot) {
     auto& stack = inventory[slot];
     if (stack.stack.empty()) return false;
     stack.stack.top()->applyEffect(*this);
+    GameplayEventBus::getInstance().publish(ItemUsed{this, stack.itemTypeName, slot});
     stack.stack.pop();
     if (stack.stack.empty()) stack.itemTypeName = "";
     return true;
@@ -9,8 +9,9 @@
 #include <stack>
 #include <array>
 #include "../items/Item.hpp"
+#include "../resources/TextureAtlas.hpp"
 
-class CameraShake; // Forward declaration
+class SpriteBatch;
 
 enum class AnimationState
 {
@@ -63,6 +64,7 @@ private:
     int currentFrame;
     int frameWidth;
     int frameHeight;
+    sf::Vector2i frameOrigin{0, 0}; // coin haut-gauche de la planche d'animation dans la texture (atlas)
     float frameTime;
     float timer;
 
@@ -151,19 +153,11 @@ private:
 
 protected:
 
-    const char* FlashShaderCode = R"(
-    uniform sampler2D texture;
-    uniform float flashAlpha;
+    // Intensité courante du flash de dégâts (0 = normal, 1 = tout blanc), attribut de sommet du SpriteBatch
+    float flashAlpha = 0.f;
 
-    void main() {
-        vec4 pixel = texture2D(texture, gl_TexCoord[0].xy);
-        // On mélange la couleur originale avec du blanc pur (1.0, 1.0, 1.0)
-        // en fonction de flashAlpha (0.0 = normal, 1.0 = tout blanc)
-        gl_FragColor = vec4(mix(pixel.rgb, vec3(1.0, 1.0, 1.0), flashAlpha), pixel.a);
-    }
-    )";
-
-    sf::Shader flashShader;
+    sf::Transform getDrawTransform() const;
+    float getFlashAmount() const;
 
     float attackCooldown;                 // Temps restant avant la prochaine attaque (accessible aux sous-classes)
     float minAttackCooldown = 0.05f;      // Minimum cooldown when stamina is used (can be overridden by Player)
@@ -179,10 +173,10 @@ protected:
     bool consumeStamina(int cost); // subtract and update endurance
     void regenStamina(float deltaTime); // regen per-frame
 
-    bool isStunned = false;
+    // applique la planche/hitbox/offset d'une animation au sprite
+    void applyAnimation(AnimationState state);
 
-    // Camera shake support
-    CameraShake* cameraShake = nullptr;
+    bool isStunned = false;
 
     std::shared_ptr<sf::Texture> texture;
     bool onGround = false;
@@ -193,6 +187,7 @@ protected:
     struct AnimationData
     {
         std::shared_ptr<sf::Texture> texture;
+        sf::Vector2i origin; // position de la planche dans la texture
         int frameCount;
         int frameWidth;
         int frameHeight;
@@ -243,6 +238,8 @@ public:
     static bool hasLineOfSight(const sf::Vector2f &from, const sf::Vector2f &to, const std::vector<std::unique_ptr<Ground>> &grounds);
     
     virtual sf::FloatRect getBounds() const;
+    // Zone occupée à l'écran par le sprite (culling)
+    sf::FloatRect getVisualBounds() const { return sprite.getGlobalBounds(); }
     bool isOnGround() const { return onGround; }
     bool isOnLadder() const { return onLadder; }
     void setClimbing(bool c) { isClimbing = c; }
@@ -256,17 +253,18 @@ public:
     void selfAnimator(float deltaTime);
     void walkAnimator(float deltaTime);
     void attackAnimator(float deltaTime, Direction direction);
-    void setAnimationTexture(AnimationState state, std::shared_ptr<sf::Texture> texture, int frameCount, int frameWidth, int frameHeight, float fps);
+    void setAnimationTexture(AnimationState state, const AtlasRegion &region, int frameCount, int frameWidth, int frameHeight, float fps);
     void setAnimationState(AnimationState newState);
     void setAnimationHitbox(AnimationState state, float offsetX, float offsetY, float width, float height);
     void setAnimationSpriteOffset(AnimationState state, float offsetX, float offsetY);
-    virtual void draw(sf::RenderWindow &window);
-    void setAnimationParams(int frameCount, int frameWidth, int frameHeight, float fps);
+    virtual void draw(sf::RenderTarget &target);
+    void submit(SpriteBatch &batch) const;
+    void setAnimationParams(int frameCount, int frameWidth, int frameHeight, float fps, const sf::Vector2i &origin = sf::Vector2i(0, 0));
 
     // Combat
 
-    virtual void attack(Direction dir, std::vector<GameCharacter *> targets, const std::vector<std::unique_ptr<Ground>> &grounds);
-    virtual void attack(Direction dir, std::vector<GameCharacter *> targets, AttackType type, const std::vector<std::unique_ptr<Ground>> &grounds);
+    virtual void attack(Direction dir, const std::vector<GameCharacter *> &targets, const std::vector<std::unique_ptr<Ground>> &grounds);
+    virtual void attack(Direction dir, const std::vector<GameCharacter *> &targets, AttackType type, const std::vector<std::unique_ptr<Ground>> &grounds);
 
     // Resolve collision with another character (push weaker one out)
     // Now includes ground collision validation to prevent pushing through walls
@@ -278,9 +276,6 @@ public:
     bool isAlive() const;
     void allCooldowns(float deltaTime);
 
-    // Camera shake support
-    void setCameraShake(CameraShake* shake) { cameraShake = shake; }
-
     // Stat modifiers (used by items)
     void restoreMana(int amount);
     void increaseMaxHp(int amount);
@@ -12,16 +12,16 @@ NonPlayer::NonPlayer(const std::string &name, int hp, int mana, int stamina, flo
 /**
  * @brief Dessine le PNJ en appelant la méthode de la classe de base.
  */
-void NonPlayer::draw(sf::RenderWindow &window)
+void NonPlayer::draw(sf::RenderTarget &target)
 {
-    GameCharacter::draw(window);
+    GameCharacter::draw(target);
 }
 
 /**
  * @brief Comportement IA par défaut (à surcharger dans les classes dérivées)
  * Par défaut, le PNJ ne fait rien.
  */
-void NonPlayer::updateBehavior(float deltaTime, Player* player, const std::vector<std::unique_ptr<Ground>>& grounds)
+void NonPlayer::updateBehavior(float deltaTime, Player* player, const std::vector<std::unique_ptr<Ground>>& grounds, CommandBuffer& commands)
 {
     // Implémentation par défaut : ne rien faire
     // Les classes dérivées peuvent surcharger cette méthode
@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+class CommandBuffer;
 class Ground;
 class Player;
 
@@ -13,11 +14,12 @@ public:
     NonPlayer(const std::string &name, int hp, int mana, int stamina, float speed, std::shared_ptr<sf::Texture> texture);
 
     // dessin éventuellement surchargé (si spécifique)
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget &target) override;
     
     /**
-     * @brief Méthode virtuelle pour le comportement IA
+     * @brief Méthode virtuelle pour le comportement IA : émet les commandes du PNJ pour ce tick
+     * (exécutées ensuite avec celles du joueur, avant la physique)
      * À surcharger dans les classes dérivées
      */
-    virtual void updateBehavior(float deltaTime, Player* player, const std::vector<std::unique_ptr<Ground>>& grounds);
+    virtual void updateBehavior(float deltaTime, Player* player, const std::vector<std::unique_ptr<Ground>>& grounds, CommandBuffer& commands);
 };
@@ -23,7 +23,7 @@ void Player::jump()
     }
 }
 
-void Player::attack(Direction dir, std::vector<GameCharacter *> targets, const std::vector<std::unique_ptr<Ground>> &grounds)
+void Player::attack(Direction dir, const std::vector<GameCharacter *> &targets, const std::vector<std::unique_ptr<Ground>> &grounds)
 {
     // prevent attacking while stunned
     if (isStunned)
@@ -50,9 +50,9 @@ void Player::attack(Direction dir, std::vector<GameCharacter *> targets, const s
 /**
  * @brief Dessine le joueur à l'écran.
  *
- * @param window La fenêtre SFML où dessiner le joueur.
+ * @param target La cible de rendu (fenêtre ou texture)
  */
-void Player::draw(sf::RenderWindow &window)
+void Player::draw(sf::RenderTarget &target)
 {
-    GameCharacter::draw(window);
+    GameCharacter::draw(target);
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "GameRandom.hpp"
+
+std::mt19937 &GameRandom::engine()
+{
+    static std::mt19937 instance(seedValue());
+    return instance;
+}
+
+std::uint32_t &GameRandom::seedValue()
+{
+    // Sans appel à seed(), une graine différente à chaque lancement (comme l'ancien srand(time))
+    static std::uint32_t value = makeSeed();
+    return value;
+}
+
+void GameRandom::seed(std::uint32_t seed)
+{
+    seedValue() = seed;
+    engine().seed(seed);
+}
+
+std::uint32_t GameRandom::getSeed()
+{
+    return seedValue();
+}
+
+std::uint32_t GameRandom::makeSeed()
+{
+    std::random_device device;
+    return device();
+}
+
+int GameRandom::below(int bound)
+{
+    return static_cast<int>(engine()() % static_cast<std::uint32_t>(bound));
+}
+
+int GameRandom::range(int min, int max)
+{
+    return min + below(max - min + 1);
+}
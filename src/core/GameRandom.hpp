@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <random>
+
+/**
+ * @brief Générateur aléatoire unique de la simulation (labyrinthe, apparitions, butin).
+ *
+ * Une graine fixée avant la génération du premier niveau donne une partie reproductible :
+ * c'est elle qu'enregistre InputRecording. Les tirages n'utilisent que les bits du moteur
+ * (pas de std::uniform_int_distribution, dont le résultat dépend de la bibliothèque standard).
+ *
+ * @note Réservé au thread de simulation
+ */
+class GameRandom
+{
+public:
+    /**
+     * @brief Réinitialise le moteur avec une graine
+     */
+    static void seed(std::uint32_t seed);
+    static std::uint32_t getSeed();
+
+    /**
+     * @brief Graine non déterministe, pour une partie normale
+     */
+    static std::uint32_t makeSeed();
+
+    // Entier dans [0, bound[ (bound > 0)
+    static int below(int bound);
+    // Entier dans [min, max], bornes comprises
+    static int range(int min, int max);
+
+private:
+    static std::mt19937 &engine();
+    static std::uint32_t &seedValue();
+};
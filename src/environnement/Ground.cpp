@@ -19,8 +19,20 @@ Ground::Ground(float x, float y, float width, float height) {
 /**
  * @brief Dessine le sol dans la fenêtre donnée.
  */
-void Ground::draw(sf::RenderWindow& window) {
-    window.draw(shape);
+void Ground::draw(sf::RenderTarget &target) {
+    target.draw(shape);
+}
+
+/**
+ * @brief Ajoute le rectangle du sol (coloré, sans texture) à un tableau de quads.
+ */
+void Ground::appendGeometry(sf::VertexArray& vertices) const {
+    const sf::FloatRect b = getBounds();
+    const sf::Color color = shape.getFillColor();
+    vertices.append(sf::Vertex(sf::Vector2f(b.left, b.top), color));
+    vertices.append(sf::Vertex(sf::Vector2f(b.left + b.width, b.top), color));
+    vertices.append(sf::Vertex(sf::Vector2f(b.left + b.width, b.top + b.height), color));
+    vertices.append(sf::Vertex(sf::Vector2f(b.left, b.top + b.height), color));
 }
 
 /**
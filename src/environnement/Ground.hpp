@@ -2,6 +2,7 @@
 #define GROUND_HPP
 
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class Ground {
 protected:
@@ -12,7 +13,12 @@ protected:
 public:
     Ground(float x, float y, float width, float height);
 
-    virtual void draw(sf::RenderWindow& window);
+    virtual void draw(sf::RenderTarget &target);
+
+    // Géométrie statique : quads du sol ajoutés au lot de sa texture (voir StaticGeometry)
+    virtual void appendGeometry(sf::VertexArray& vertices) const;
+    // Texture du lot (nullptr : quads colorés sans texture)
+    virtual std::shared_ptr<sf::Texture> getBatchTexture() const { return nullptr; }
 
     const sf::FloatRect getBounds() const;
 
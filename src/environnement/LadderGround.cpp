@@ -7,25 +7,12 @@
  * @param y Position Y du sol
  * @param width Largeur du sol
  * @param height Hauteur du sol
- * @param texture Texture à appliquer (répétée automatiquement)
- * @note Il est important que la texture passée en paramètre ait son mode "repeated" activé via setRepeated(true).
+ * @param region Région de l'atlas à appliquer (répétée pour couvrir toute l'échelle)
  */
-LadderGround::LadderGround(float x, float y, float width, float height, const sf::Texture &texture)
-    : Ground(x, y, width, height), texturePtr(&texture)
+LadderGround::LadderGround(float x, float y, float width, float height, const AtlasRegion &region)
+    : Ground(x, y, width, height), texture(region.texture)
 {
-    int texW = texturePtr->getSize().x;
-    int texH = texturePtr->getSize().y;
-
-    std::cout << "LadderGround: texture size = " << texW << "x" << texH << "\n";
-
-    const_cast<sf::Texture &>(texture).setRepeated(true);
-
-    texturedShape.setPosition(x, y);
-    texturedShape.setSize(sf::Vector2f(width, height));
-
-    texturedShape.setTexture(&texture);
-
-    texturedShape.setTextureRect(sf::IntRect(0, 0, width, height));
+    TextureAtlas::appendTiledQuads(tiledQuads, sf::FloatRect(x, y, width, height), region.rect);
 
     this->isSolid = false;
 }
@@ -34,39 +21,27 @@ LadderGround::~LadderGround() = default;
 
 /**
  * @brief Dessine le sol échelle dans la fenêtre donnée.
- * @param window La fenêtre SFML où dessiner le sol.
+ * @param target La cible de rendu (fenêtre ou texture)
  */
-void LadderGround::draw(sf::RenderWindow &window)
+void LadderGround::draw(sf::RenderTarget &target)
 {
-    if (!tiles.empty())
-    {
-        for (auto &s : tiles)
-            window.draw(s);
-    }
-    else
-    {
-        window.draw(texturedShape);
-    }
+    target.draw(tiledQuads, texture.get());
 }
 
-sf::Texture *LadderGround::getDefaultTexture()
+/**
+ * @brief Ajoute les quads déjà pavés au lot de la texture de l'atlas.
+ */
+void LadderGround::appendGeometry(sf::VertexArray &vertices) const
 {
-    static sf::Texture defaultTexture;
-    static bool isLoaded = false;
-
-    if (!isLoaded)
-    {
-        if (!defaultTexture.loadFromFile("../src/assets/images/ladder.png"))
-        {
-            std::cerr << "Erreur : impossible de charger ../src/assets/images/ladder.png\n";
-        }
-        else
-        {
-            defaultTexture.setRepeated(true);
-            isLoaded = true;
-            std::cout << "Texture par défaut chargée avec succès\n";
-        }
-    }
+    for (std::size_t i = 0; i < tiledQuads.getVertexCount(); ++i)
+        vertices.append(tiledQuads[i]);
+}
 
-    return &defaultTexture;
-}
\ No newline at end of file
+/**
+ * @brief Retourne la région de l'atlas utilisée par défaut pour les échelles.
+ */
+const AtlasRegion &LadderGround::getDefaultRegion()
+{
+    static AtlasRegion defaultRegion = TextureAtlas::getDefault().getRegion("ladder.png");
+    return defaultRegion;
+}
@@ -2,25 +2,27 @@
 #define LADDERGROUND_HPP
 #pragma once
 #include "Ground.hpp"
+#include "../resources/TextureAtlas.hpp"
 #include <SFML/Graphics.hpp>
 #include <vector>
 
 class LadderGround : public Ground
 {
 private:
-    const sf::Texture* texturePtr = nullptr;
-
-    std::vector<sf::Sprite> tiles;
-    
-    sf::RectangleShape texturedShape;
+    // Quads pavant l'échelle avec la région de l'atlas
+    sf::VertexArray tiledQuads{sf::Quads};
+    std::shared_ptr<sf::Texture> texture;
 public:
-    LadderGround(float x, float y, float width, float height, const sf::Texture& texture);
+    LadderGround(float x, float y, float width, float height, const AtlasRegion& region);
     ~LadderGround();
 
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget &target) override;
+
+    void appendGeometry(sf::VertexArray& vertices) const override;
+    std::shared_ptr<sf::Texture> getBatchTexture() const override { return texture; }
 
     bool isLadder() const { return true;}
 
-    static sf::Texture* getDefaultTexture();
+    static const AtlasRegion& getDefaultRegion();
 };
-#endif
\ No newline at end of file
+#endif
@@ -1,9 +1,8 @@
 #include "ModelGenerator.hpp"
 #include "Node.hpp"
+#include "../core/GameRandom.hpp"
 #include <stack>
 #include <algorithm>
-#include <random>
-#include <ctime>
 
 /**
  * @brief Constructeur de la classe ModelGenerator.
@@ -59,17 +58,16 @@ void ModelGenerator::generateMaze(int w, int h)
     // 3. DFS Backtracking
     std::stack<Node *> stack;
 
-    std::srand(std::time(nullptr));
-
     Node *start = grid[(height - 1) * width + 0];
     start->setVisited(true);
     stack.push(start);
 
+    std::vector<Node *> unvisited; // réutilisé d'un nœud à l'autre
     while (!stack.empty())
     {
         Node *current = stack.top();
 
-        std::vector<Node *> unvisited;
+        unvisited.clear();
         for (Node *n : current->getNeighbors())
             if (!n->isVisited())
                 unvisited.push_back(n);
@@ -80,7 +78,7 @@ void ModelGenerator::generateMaze(int w, int h)
         }
         else
         {
-            Node *next = unvisited[std::rand() % unvisited.size()];
+            Node *next = unvisited[GameRandom::below(static_cast<int>(unvisited.size()))];
 
             current->removeWallWith(next);
 
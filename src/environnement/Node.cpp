@@ -92,7 +92,7 @@ void Node::setVisited(bool a)
     this->visited = a;
 }
 
-std::vector<Node *> Node::getNeighbors()
+const std::vector<Node *> &Node::getNeighbors() const
 {
     return (this->neighbors);
 }
\ No newline at end of file
@@ -27,7 +27,7 @@ public:
     Node(int id, int xPos, int yPos);
     void addNeighbors(Node *n);
     bool isPositionsNeighbors(Node *n);
-    std::vector<Node *> getNeighbors();
+    const std::vector<Node *> &getNeighbors() const;
     int getxPos() { return xPos; }
     int getyPos() { return yPos; }
     void removeWallWith(Node *other);
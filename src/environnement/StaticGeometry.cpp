@@ -0,0 +1,119 @@
+#include "StaticGeometry.hpp"
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+/**
+ * @brief Regroupe les quads des sols par texture puis par cellule, et les envoie au GPU.
+ *
+ * @param grounds Les sols du niveau (l'ordre de dessin est conservé au sein d'une cellule)
+ * @param grid Grille du labyrinthe
+ */
+void StaticGeometry::build(const std::vector<std::unique_ptr<Ground>> &grounds, const VisibilityGrid &grid)
+{
+    clear();
+    this->grid = grid;
+
+    const int cellCount = std::max(1, grid.getCellCount());
+    std::vector<int> cellOf(grounds.size());
+    groundsPerCell.assign(static_cast<std::size_t>(cellCount), 0);
+    for (std::size_t i = 0; i < grounds.size(); ++i)
+    {
+        sf::FloatRect b = grounds[i]->getBounds();
+        cellOf[i] = grid.getCellIndex(sf::Vector2f(b.left + b.width / 2.f, b.top + b.height / 2.f));
+        ++groundsPerCell[static_cast<std::size_t>(cellOf[i])];
+    }
+    groundCount = static_cast<unsigned>(grounds.size());
+
+    std::vector<std::size_t> order(grounds.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&cellOf](std::size_t a, std::size_t b)
+                     { return cellOf[a] < cellOf[b]; });
+
+    for (std::size_t i : order)
+    {
+        const auto &g = grounds[i];
+        std::shared_ptr<sf::Texture> texture = g->getBatchTexture();
+        Batch *batch = nullptr;
+        for (auto &b : batches)
+        {
+            if (b.texture == texture)
+            {
+                batch = &b;
+                break;
+            }
+        }
+        if (!batch)
+        {
+            batches.emplace_back();
+            batch = &batches.back();
+            batch->texture = texture;
+            batch->cellStart.assign(static_cast<std::size_t>(cellCount) + 1, 0);
+        }
+        g->appendGeometry(batch->vertices);
+        // Fin (provisoire) de la cellule du sol : les cellules suivantes commencent après lui
+        for (std::size_t c = static_cast<std::size_t>(cellOf[i]) + 1; c < batch->cellStart.size(); ++c)
+            batch->cellStart[c] = batch->vertices.getVertexCount();
+    }
+
+    std::size_t vertexCount = 0;
+    for (auto &b : batches)
+    {
+        vertexCount += b.vertices.getVertexCount();
+        if (b.vertices.getVertexCount() > 0 && sf::VertexBuffer::isAvailable() && b.buffer.create(b.vertices.getVertexCount()))
+            b.useBuffer = b.buffer.update(&b.vertices[0]);
+    }
+
+    std::cout << "StaticGeometry: " << grounds.size() << " sols, " << vertexCount << " sommets en "
+              << batches.size() << " lot(s)\n";
+}
+
+void StaticGeometry::clear()
+{
+    batches.clear();
+    groundsPerCell.clear();
+    groundCount = 0;
+}
+
+void StaticGeometry::draw(sf::RenderTarget &target, CullingStats &stats) const
+{
+    if (grid.getCellCount() == 0)
+    {
+        for (const auto &b : batches)
+            drawRange(target, b, 0, b.vertices.getVertexCount());
+        stats.drawn += groundCount;
+        return;
+    }
+
+    const sf::IntRect range = grid.getCellRange(VisibilityGrid::getViewRect(target.getView()));
+    const int columns = grid.getColumns();
+
+    // Les cellules d'une même ligne sont contiguës : un appel par ligne visible
+    for (const auto &b : batches)
+    {
+        for (int row = range.top; row < range.top + range.height; ++row)
+        {
+            std::size_t firstCell = static_cast<std::size_t>(row * columns + range.left);
+            std::size_t first = b.cellStart[firstCell];
+            std::size_t last = b.cellStart[firstCell + static_cast<std::size_t>(range.width)];
+            if (last > first)
+                drawRange(target, b, first, last - first);
+        }
+    }
+
+    unsigned drawn = 0;
+    for (int row = range.top; row < range.top + range.height; ++row)
+        for (int col = range.left; col < range.left + range.width; ++col)
+            drawn += groundsPerCell[static_cast<std::size_t>(row * columns + col)];
+    stats.drawn += drawn;
+    stats.culled += groundCount - drawn;
+}
+
+void StaticGeometry::drawRange(sf::RenderTarget &target, const Batch &batch, std::size_t first, std::size_t count) const
+{
+    sf::RenderStates states(batch.texture.get());
+    if (batch.useBuffer)
+        target.draw(batch.buffer, first, count, states);
+    else
+        target.draw(&batch.vertices[first], count, sf::Quads, states);
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+#include "Ground.hpp"
+#include "VisibilityGrid.hpp"
+
+/**
+ * @brief Géométrie statique d'un niveau (sols, murs, échelles) regroupée par texture.
+ *
+ * Construite une fois à la génération du niveau : tous les quads d'une même texture sont
+ * envoyés au GPU dans un sf::VertexBuffer statique (ou un sf::VertexArray si les VBO ne sont
+ * pas disponibles). Les quads sont triés par cellule du labyrinthe : seules les lignes de
+ * cellules visibles sont soumises. Ground::draw reste utilisable pour le debug ou pour un
+ * sol qui bougerait.
+ */
+class StaticGeometry
+{
+public:
+    /**
+     * @brief Reconstruit les lots à partir des sols du niveau
+     * @param grid Grille du labyrinthe utilisée pour ranger les quads par cellule
+     */
+    void build(const std::vector<std::unique_ptr<Ground>> &grounds, const VisibilityGrid &grid);
+
+    void clear();
+
+    /**
+     * @brief Dessine les cellules visibles de chaque lot (un appel par texture et par ligne de cellules)
+     */
+    void draw(sf::RenderTarget &target, CullingStats &stats) const;
+
+    std::size_t getBatchCount() const { return batches.size(); }
+
+private:
+    struct Batch
+    {
+        std::shared_ptr<sf::Texture> texture;
+        sf::VertexArray vertices{sf::Quads};
+        sf::VertexBuffer buffer{sf::Quads, sf::VertexBuffer::Static};
+        bool useBuffer = false;
+        // Premier sommet de chaque cellule (cellStart[i + 1] - cellStart[i] sommets dans la cellule i)
+        std::vector<std::size_t> cellStart;
+    };
+
+    std::vector<Batch> batches;
+    VisibilityGrid grid;
+    std::vector<unsigned> groundsPerCell;
+    unsigned groundCount = 0;
+
+    void drawRange(sf::RenderTarget &target, const Batch &batch, std::size_t first, std::size_t count) const;
+};
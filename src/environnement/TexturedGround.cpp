@@ -7,47 +7,37 @@
  * @param y Position Y du sol
  * @param width Largeur du sol
  * @param height Hauteur du sol
- * @param texture Texture à appliquer (répétée automatiquement)
- * @note Il est important que la texture passée en paramètre ait son mode "repeated" activé via setRepeated(true).
+ * @param region Région de l'atlas à appliquer (répétée pour couvrir tout le sol)
  */
-TexturedGround::TexturedGround(float x, float y, float width, float height, const sf::Texture& texture)
-    : Ground(x, y, width, height)
+TexturedGround::TexturedGround(float x, float y, float width, float height, const AtlasRegion& region)
+    : Ground(x, y, width, height), texture(region.texture)
 {
-    texturedShape.setSize(sf::Vector2f(width, height));
-    texturedShape.setPosition(x, y);
-
-    // Applique la texture répétée
-    texturedShape.setTexture(&texture);
-    texturedShape.setTextureRect(sf::IntRect(0, 0, static_cast<int>(width), static_cast<int>(height)));
+    TextureAtlas::appendTiledQuads(tiledQuads, sf::FloatRect(x, y, width, height), region.rect);
 }
 
 /**
  * @brief Dessine le sol texturé dans la fenêtre donnée.
- * @param window La fenêtre SFML où dessiner le sol.
+ * @param target La cible de rendu (fenêtre ou texture)
  */
-void TexturedGround::draw(sf::RenderWindow& window)
+void TexturedGround::draw(sf::RenderTarget &target)
 {
-    window.draw(texturedShape);
+    target.draw(tiledQuads, texture.get());
 }
 
-sf::Texture* TexturedGround::getDefaultTexture()
+/**
+ * @brief Ajoute les quads déjà pavés au lot de la texture de l'atlas.
+ */
+void TexturedGround::appendGeometry(sf::VertexArray& vertices) const
 {
-    static sf::Texture defaultTexture;
-    static bool isLoaded = false;
-
-    if (!isLoaded)
-    {
-        if (!defaultTexture.loadFromFile("../src/assets/images/brick.png"))
-        {
-            std::cerr << "Erreur : impossible de charger ../src/assets/images/brick.png\n";
-        }
-        else
-        {
-            defaultTexture.setRepeated(true);
-            isLoaded = true;
-            std::cout << "Texture par défaut chargée avec succès\n";
-        }
-    }
+    for (std::size_t i = 0; i < tiledQuads.getVertexCount(); ++i)
+        vertices.append(tiledQuads[i]);
+}
 
-    return &defaultTexture;
+/**
+ * @brief Retourne la région de l'atlas utilisée par défaut pour les murs et sols (briques).
+ */
+const AtlasRegion& TexturedGround::getDefaultRegion()
+{
+    static AtlasRegion defaultRegion = TextureAtlas::getDefault().getRegion("brick.png");
+    return defaultRegion;
 }
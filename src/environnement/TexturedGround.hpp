@@ -1,16 +1,21 @@
 #pragma once
 #include "Ground.hpp"
+#include "../resources/TextureAtlas.hpp"
 #include <SFML/Graphics.hpp>
 
 class TexturedGround : public Ground {
 public:
-    TexturedGround(float x, float y, float width, float height, const sf::Texture& texture);
+    TexturedGround(float x, float y, float width, float height, const AtlasRegion& region);
 
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget &target) override;
 
-    static sf::Texture* getDefaultTexture();
+    void appendGeometry(sf::VertexArray& vertices) const override;
+    std::shared_ptr<sf::Texture> getBatchTexture() const override { return texture; }
+
+    static const AtlasRegion& getDefaultRegion();
 
 private:
-    sf::RectangleShape texturedShape;
-    sf::Texture texture;
+    // Quads pavant le sol avec la région de l'atlas (une texture d'atlas ne peut pas être répétée)
+    sf::VertexArray tiledQuads{sf::Quads};
+    std::shared_ptr<sf::Texture> texture;
 };
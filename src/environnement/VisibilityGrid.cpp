@@ -0,0 +1,105 @@
+#include "VisibilityGrid.hpp"
+#include "../objects/Object.hpp"
+#include "../characters/GameCharacter.hpp"
+#include "../rendering/SpriteBatch.hpp"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Construit une grille de cellules
+ * @param cellSize Taille d'une cellule du labyrinthe, en coordonnées monde
+ * @param columns Nombre de colonnes du labyrinthe
+ * @param rows Nombre de lignes du labyrinthe
+ */
+VisibilityGrid::VisibilityGrid(const sf::Vector2f &cellSize, int columns, int rows)
+    : cellSize(cellSize), columns(columns), rows(rows)
+{
+}
+
+int VisibilityGrid::getCellIndex(const sf::Vector2f &point) const
+{
+    if (columns <= 0 || rows <= 0)
+        return 0;
+    int col = std::clamp(static_cast<int>(std::floor(point.x / cellSize.x)), 0, columns - 1);
+    int row = std::clamp(static_cast<int>(std::floor(point.y / cellSize.y)), 0, rows - 1);
+    return row * columns + col;
+}
+
+sf::IntRect VisibilityGrid::getCellRange(const sf::FloatRect &area) const
+{
+    if (columns <= 0 || rows <= 0)
+        return sf::IntRect();
+    int left = std::clamp(static_cast<int>(std::floor(area.left / cellSize.x)) - 1, 0, columns - 1);
+    int top = std::clamp(static_cast<int>(std::floor(area.top / cellSize.y)) - 1, 0, rows - 1);
+    int right = std::clamp(static_cast<int>(std::floor((area.left + area.width) / cellSize.x)) + 1, 0, columns - 1);
+    int bottom = std::clamp(static_cast<int>(std::floor((area.top + area.height) / cellSize.y)) + 1, 0, rows - 1);
+    return sf::IntRect(left, top, right - left + 1, bottom - top + 1);
+}
+
+void VisibilityGrid::bucketObjects(const std::vector<std::unique_ptr<Object>> &objects)
+{
+    objectBuckets.assign(static_cast<size_t>(getCellCount()), {});
+    if (objectBuckets.empty())
+        return;
+    for (const auto &obj : objects)
+    {
+        sf::FloatRect b = obj->getVisualBounds();
+        objectBuckets[getCellIndex(sf::Vector2f(b.left + b.width / 2.f, b.top + b.height / 2.f))].push_back(obj.get());
+    }
+}
+
+void VisibilityGrid::submitObjects(SpriteBatch &batch, const sf::FloatRect &viewRect, CullingStats &stats) const
+{
+    if (objectBuckets.empty())
+        return;
+
+    const sf::IntRect range = getCellRange(viewRect);
+    size_t total = 0;
+    for (const auto &bucket : objectBuckets)
+        total += bucket.size();
+
+    unsigned drawn = 0;
+    for (int row = range.top; row < range.top + range.height; ++row)
+    {
+        for (int col = range.left; col < range.left + range.width; ++col)
+        {
+            for (Object *obj : objectBuckets[static_cast<size_t>(row * columns + col)])
+            {
+                if (!obj->getVisualBounds().intersects(viewRect))
+                    continue;
+                obj->submit(batch);
+                ++drawn;
+            }
+        }
+    }
+    stats.drawn += drawn;
+    stats.culled += static_cast<unsigned>(total) - drawn;
+}
+
+sf::FloatRect VisibilityGrid::getViewRect(const sf::View &view)
+{
+    const sf::Vector2f size = view.getSize();
+    const sf::Vector2f center = view.getCenter();
+    return sf::FloatRect(center.x - size.x / 2.f, center.y - size.y / 2.f, size.x, size.y);
+}
+
+void VisibilityGrid::collectVisibleCharacters(const sf::FloatRect &viewRect, const std::vector<GameCharacter *> &characters,
+                                              std::vector<GameCharacter *> &visible, CullingStats &stats)
+{
+    // Marge pour les barres de vie dessinées au-dessus des têtes
+    const sf::FloatRect area(viewRect.left - characterMargin, viewRect.top - characterMargin,
+                             viewRect.width + 2.f * characterMargin, viewRect.height + 2.f * characterMargin);
+    visible.clear();
+    for (GameCharacter *character : characters)
+    {
+        if (!character->isAlive())
+            continue;
+        if (character->getVisualBounds().intersects(area))
+        {
+            visible.push_back(character);
+            ++stats.drawn;
+        }
+        else
+            ++stats.culled;
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+
+class Object;
+class GameCharacter;
+class SpriteBatch;
+
+/**
+ * @brief Compteurs du culling pour une frame (affichés par le DevMode)
+ */
+struct CullingStats
+{
+    unsigned drawn = 0;
+    unsigned culled = 0;
+
+    void reset() { drawn = culled = 0; }
+};
+
+/**
+ * @brief Découpage du monde en cellules du labyrinthe, pour ne soumettre que ce que la vue montre.
+ *
+ * Les éléments statiques (objets, sols) sont rangés par cellule au chargement du niveau ;
+ * à chaque frame, seules les cellules couvertes par la vue (plus une cellule de marge, pour
+ * les éléments qui débordent de leur cellule) sont parcourues.
+ */
+class VisibilityGrid
+{
+public:
+    VisibilityGrid() = default;
+    VisibilityGrid(const sf::Vector2f &cellSize, int columns, int rows);
+
+    int getColumns() const { return columns; }
+    int getRows() const { return rows; }
+    int getCellCount() const { return columns * rows; }
+
+    /**
+     * @brief Index (ligne * colonnes + colonne) de la cellule contenant un point, borné à la grille
+     */
+    int getCellIndex(const sf::Vector2f &point) const;
+
+    /**
+     * @brief Cellules couvertes par une zone, avec une cellule de marge (left/top = première colonne/ligne)
+     */
+    sf::IntRect getCellRange(const sf::FloatRect &area) const;
+
+    /**
+     * @brief Range les objets du niveau par cellule (à refaire si la liste change)
+     */
+    void bucketObjects(const std::vector<std::unique_ptr<Object>> &objects);
+
+    /**
+     * @brief Ajoute au lot de sprites les objets visibles dans une zone
+     */
+    void submitObjects(SpriteBatch &batch, const sf::FloatRect &viewRect, CullingStats &stats) const;
+
+    /**
+     * @brief Retourne la zone du monde couverte par une vue
+     */
+    static sf::FloatRect getViewRect(const sf::View &view);
+
+    /**
+     * @brief Sélectionne les personnages vivants visibles (ils bougent : test direct, pas de cellule)
+     */
+    static void collectVisibleCharacters(const sf::FloatRect &viewRect, const std::vector<GameCharacter *> &characters,
+                                         std::vector<GameCharacter *> &visible, CullingStats &stats);
+
+private:
+    sf::Vector2f cellSize{1.f, 1.f};
+    int columns = 0;
+    int rows = 0;
+
+    std::vector<std::vector<Object *>> objectBuckets;
+
+    static constexpr float characterMargin = 32.f;
+};
@@ -0,0 +1,86 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include "../characters/Direction.hpp"
+#include "../characters/GameCharacter.hpp"
+
+/**
+ * @brief Type d'une commande de personnage (exécutée par CommandBuffer avec un switch)
+ */
+enum class CommandType : std::uint8_t
+{
+    Move,     // offset : déplacement à appliquer
+    Jump,     // joueur uniquement
+    Dash,     // value : direction (-1 ou +1)
+    Attack,   // value : Direction, attackType, target (nullptr : tous les personnages)
+    Interact, // coffre ou porte sous le joueur
+    UseItem,  // value : case de l'inventaire
+    Climb     // value : 1 pour grimper (gravité coupée sur une échelle), 0 sinon
+};
+
+/**
+ * @brief Commande d'un personnage : structure simple rangée par valeur, sans allocation.
+ *
+ * Émise par l'entrée du joueur (EventManager) comme par l'IA (NonPlayer::updateBehavior).
+ * Les personnages sont désignés par pointeur, valable pendant le tick ; une sérialisation
+ * (rejeu, réseau) les remplacerait par leur indice dans la liste des personnages.
+ */
+struct Command
+{
+    CommandType type = CommandType::Move;
+    AttackType attackType = AttackType::SwordAttack;
+    std::int16_t value = 0;
+    GameCharacter *actor = nullptr;
+    GameCharacter *target = nullptr;
+    sf::Vector2f offset;
+
+    static Command move(GameCharacter &actor, const sf::Vector2f &offset)
+    {
+        Command command = make(CommandType::Move, actor);
+        command.offset = offset;
+        return command;
+    }
+
+    static Command jump(GameCharacter &actor) { return make(CommandType::Jump, actor); }
+
+    static Command dash(GameCharacter &actor, int direction)
+    {
+        Command command = make(CommandType::Dash, actor);
+        command.value = static_cast<std::int16_t>(direction);
+        return command;
+    }
+
+    static Command attack(GameCharacter &actor, Direction direction, AttackType type = AttackType::SwordAttack, GameCharacter *target = nullptr)
+    {
+        Command command = make(CommandType::Attack, actor);
+        command.value = static_cast<std::int16_t>(direction);
+        command.attackType = type;
+        command.target = target;
+        return command;
+    }
+
+    static Command interact(GameCharacter &actor) { return make(CommandType::Interact, actor); }
+
+    static Command useItem(GameCharacter &actor, int slot)
+    {
+        Command command = make(CommandType::UseItem, actor);
+        command.value = static_cast<std::int16_t>(slot);
+        return command;
+    }
+
+    static Command climb(GameCharacter &actor, bool climbing)
+    {
+        Command command = make(CommandType::Climb, actor);
+        command.value = climbing ? 1 : 0;
+        return command;
+    }
+
+private:
+    static Command make(CommandType type, GameCharacter &actor)
+    {
+        Command command;
+        command.type = type;
+        command.actor = &actor;
+        return command;
+    }
+};
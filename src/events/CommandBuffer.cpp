@@ -0,0 +1,52 @@
+#include "CommandBuffer.hpp"
+#include "../characters/Player.hpp"
+
+CommandBuffer::CommandBuffer()
+{
+    commands.reserve(initialCapacity);
+    singleTarget.reserve(1);
+}
+
+void CommandBuffer::execute(CommandContext &context)
+{
+    for (const Command &command : commands)
+    {
+        GameCharacter &actor = *command.actor;
+        switch (command.type)
+        {
+        case CommandType::Move:
+            actor.move(command.offset);
+            break;
+        case CommandType::Jump:
+            if (Player *player = dynamic_cast<Player *>(&actor))
+                player->jump();
+            break;
+        case CommandType::Dash:
+            actor.startDash(command.value);
+            break;
+        case CommandType::Attack:
+        {
+            const Direction direction = static_cast<Direction>(command.value);
+            if (command.target)
+                singleTarget.assign(1, command.target);
+            const std::vector<GameCharacter *> &targets = command.target ? singleTarget : context.characters;
+            // L'attaque à l'épée passe par la surcharge du joueur (endurance, cooldown)
+            if (command.attackType == AttackType::SwordAttack)
+                actor.attack(direction, targets, context.grounds);
+            else
+                actor.attack(direction, targets, command.attackType, context.grounds);
+            break;
+        }
+        case CommandType::Interact:
+            context.interactRequested = true;
+            break;
+        case CommandType::UseItem:
+            actor.useItem(command.value);
+            break;
+        case CommandType::Climb:
+            actor.setClimbing(command.value != 0);
+            break;
+        }
+    }
+    commands.clear();
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Command.hpp"
+
+class Ground;
+
+/**
+ * @brief Ce dont l'exécution des commandes a besoin, et ce qu'elle signale en retour
+ */
+struct CommandContext
+{
+    const std::vector<GameCharacter *> &characters; // cibles des attaques sans cible désignée
+    const std::vector<std::unique_ptr<Ground>> &grounds;
+    bool interactRequested = false; // levé par une commande Interact
+};
+
+/**
+ * @brief Commandes d'un tick, exécutées dans leur ordre d'émission puis effacées.
+ *
+ * Le même tampon reçoit les commandes du joueur et celles de l'IA ; sa capacité est gardée
+ * d'un tick à l'autre, si bien qu'une frame en régime établi n'alloue pas.
+ */
+class CommandBuffer
+{
+public:
+    CommandBuffer();
+
+    void push(const Command &command) { commands.push_back(command); }
+
+    /**
+     * @brief Exécute toutes les commandes en attente (switch sur le type) puis vide le tampon
+     */
+    void execute(CommandContext &context);
+
+    // Commandes en attente, dans l'ordre d'émission
+    const std::vector<Command> &getPending() const { return commands; }
+    bool empty() const { return commands.empty(); }
+
+private:
+    static constexpr std::size_t initialCapacity = 64;
+
+    std::vector<Command> commands;
+    std::vector<GameCharacter *> singleTarget; // cible désignée d'une attaque (réutilisé)
+};
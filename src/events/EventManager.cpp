@@ -1,103 +1,63 @@
 #include "EventManager.hpp"
-#include "Event.hpp"
-#include "MoveEvent.hpp"
-#include <SFML/Window/Keyboard.hpp>
-#include <SFML/Window/Event.hpp>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
 /**
- * @brief L'EventManager s'occupe de créer tous les évenements et et tous les executer à chaque frame.
- */
-EventManager::EventManager(sf::RenderWindow &win)
-    : window(win) {}
-
-/**
- * @brief Traite les événements de la fenêtre et exécute les événements en attente.
+ * @brief Traduit l'entrée d'un tick en commandes du joueur.
  *
+ * @param input L'état des boutons pendant ce tick.
  * @param player Le joueur principal.
- * @param allCharacters Tous les personnages du jeu (joueur et PNJ).
+ * @param commands Le tampon du tick (exécuté ensuite par GameSession).
  */
-#include "../ui/UIManager.hpp"
-
-void EventManager::processEvents(Player &player, std::vector<GameCharacter *> allCharacters, const std::vector<std::unique_ptr<Ground>> &grounds)
+void EventManager::processEvents(const InputState &input, Player &player, CommandBuffer &commands)
 {
-    sf::Event event;
-    while (window.pollEvent(event))
-    {
-        if (event.type == sf::Event::Closed)
-            window.close();
-    }
+    previousInput = this->input;
+    this->input = input;
 
     // Gestion de l'ouverture/fermeture de l'inventaire
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::I)) {
-        if (!iKeyPressed) {
-            inventoryOpen = !inventoryOpen;
-            iKeyPressed = true;
-            if (inventoryOpen) paused = true;
-            else paused = false;
-        }
-    } else {
-        iKeyPressed = false;
+    if (wasPressed(InputButton::Inventory)) {
+        inventoryOpen = !inventoryOpen;
+        paused = inventoryOpen;
     }
 
     if (inventoryOpen) {
-        // Navigation dans l'inventaire via UIManager
-        if (uiManager) {
-            InventoryMenu& invMenu = uiManager->getInventoryMenu();
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left)) {
-                if (!leftPressed) { invMenu.moveSelection(-1); leftPressed = true; }
-            } else leftPressed = false;
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) {
-                if (!rightPressed) { invMenu.moveSelection(1); rightPressed = true; }
-            } else rightPressed = false;
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Enter)) {
-                if (!enterPressed) {
-                    player.useItem(invMenu.getSelectedSlot());
-                    enterPressed = true;
-                }
-            } else enterPressed = false;
-        }
+        // Navigation dans l'inventaire (flèches), Entrée utilise l'item sélectionné
+        const int lastSlot = static_cast<int>(player.getInventory().size()) - 1;
+        if (wasPressed(InputButton::AttackLeft))
+            inventorySelection = std::max(0, inventorySelection - 1);
+        if (wasPressed(InputButton::AttackRight))
+            inventorySelection = std::min(lastSlot, inventorySelection + 1);
+        if (wasPressed(InputButton::Confirm))
+            commands.push(Command::useItem(player, inventorySelection));
         // When inventory is open, skip other game inputs
         return;
     }
 
-    // Ne traiter les événements du jeu que si pas en pause
+    // Ne traiter les entrées du jeu que si pas en pause
     if (!paused)
     {
-        handleKeyboard(player, 1.f / 60.f, allCharacters, grounds);
-    }
-
-    // Exécute tous les événements
-    for (auto &ev : eventQueue)
-    {
-        ev->execute();
+        handleKeyboard(player, 1.f / 60.f, commands);
     }
-
-    eventQueue.clear();
 }
 
 /**
- * @brief Gère les entrées clavier pour le joueur et crée les événements correspondants.
+ * @brief Gère les entrées de jeu du joueur et émet les commandes correspondantes.
  *
  * @param player Le joueur principal.
  * @param deltaTime Le temps écoulé depuis la dernière frame.
- * @param allCharacters Tous les personnages du jeu (joueur et PNJ).
+ * @param commands Le tampon du tick.
  */
-void EventManager::handleKeyboard(Player &player, float deltaTime, std::vector<GameCharacter *> allCharacters, const std::vector<std::unique_ptr<Ground>> &grounds)
+void EventManager::handleKeyboard(Player &player, float deltaTime, CommandBuffer &commands)
 {
     sf::Vector2f direction(0.f, 0.f);
-    static sf::Vector2f lastGroundDirection(0.f, 0.f);  // Tracker last direction when grounded
-
-    // Réinitialiser le flag d'interaction
-    interactPressed = false;
 
     // Déplacemnts Standard (seulement au sol - en l'air, garde son élan)
     if (player.isOnGround() || player.isOnLadder())
     {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Q))
+        if (input.isDown(InputButton::MoveLeft))
             direction.x -= 1.f;
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::D))
+        if (input.isDown(InputButton::MoveRight))
             direction.x += 1.f;
         lastGroundDirection = direction;  // Save the direction when grounded
     }
@@ -107,84 +67,62 @@ void EventManager::handleKeyboard(Player &player, float deltaTime, std::vector<G
         direction = lastGroundDirection;
     }
     // Jump when on ground
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Z) && player.isOnGround() && !player.isOnLadder())
+    if (input.isDown(InputButton::Up) && player.isOnGround() && !player.isOnLadder())
     {
-        player.jump();
+        commands.push(Command::jump(player));
     }
 
     // Ladder climbing: if player overlaps a ladder, allow vertical movement using Z (up) / S (down)
     bool verticalInput = false;
     if (player.isOnLadder())
     {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Z))
+        if (input.isDown(InputButton::Up))
         {
             direction.y -= 1.f;
             verticalInput = true;
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::S))
+        if (input.isDown(InputButton::Down))
         {
             direction.y += 1.f;
             verticalInput = true;
         }
         // When vertical input on a ladder, enable climbing mode on the player so gravity is disabled
-        player.setClimbing(verticalInput);
+        commands.push(Command::climb(player, verticalInput));
     }
     else
     {
         // Ensure climbing mode is disabled when not on ladder
-        player.setClimbing(false);
+        commands.push(Command::climb(player, false));
     }
     
     // Attaque a droite ou a gauche
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
+    if (input.isDown(InputButton::AttackRight))
     {
-        player.attack(Direction::Right, allCharacters, grounds);
+        commands.push(Command::attack(player, Direction::Right));
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
+    if (input.isDown(InputButton::AttackLeft))
     {
-        player.attack(Direction::Left, allCharacters, grounds);
+        commands.push(Command::attack(player, Direction::Left));
     }
 
     // Interaction (E pour ouvrir coffres, etc.)
-    static bool eKeyPressed = false;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::E))
-    {
-        if (!eKeyPressed)
-        {
-            interactPressed = true;
-            eKeyPressed = true;
-        }
-    }
-    else
-    {
-        eKeyPressed = false;
-    }
+    if (wasPressed(InputButton::Interact))
+        commands.push(Command::interact(player));
 
     // Vue de la carte (M pour map)
-    static bool mKeyPressed = false;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::M))
-    {
-        if (!mKeyPressed)
-        {
-            toggleMapView();
-            mKeyPressed = true;
-        }
-    }
-    else
-    {
-        mKeyPressed = false;
-    }
+    if (wasPressed(InputButton::Map))
+        toggleMapView();
 
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space) && player.isCanDash())
+    if (input.isDown(InputButton::Dash) && player.isCanDash())
     {
         int dir = 0;
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::D))
+        if (input.isDown(InputButton::MoveRight))
             dir = 1;
-        else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Q))
+        else if (input.isDown(InputButton::MoveLeft))
             dir = -1;
 
         if (dir != 0)
-            player.startDash(dir);
+            commands.push(Command::dash(player, dir));
     }
 
     if (direction.x != 0.f || direction.y != 0.f)
@@ -194,8 +132,6 @@ void EventManager::handleKeyboard(Player &player, float deltaTime, std::vector<G
         if (length > 0.f)
             direction /= length;
 
-        eventQueue.push_back(std::make_unique<MoveEvent>(
-            player,
-            direction * player.getSpeed() * deltaTime));
+        commands.push(Command::move(player, direction * player.getSpeed() * deltaTime));
     }
 }
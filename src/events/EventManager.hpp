@@ -1,44 +1,44 @@
 #pragma once
-#include <SFML/Graphics/RenderWindow.hpp>
-#include <memory>
-#include <vector>
-#include "Event.hpp"
+#include "CommandBuffer.hpp"
 #include "../characters/Player.hpp"
+#include "../input/InputState.hpp"
 
-
-class GameCharacter;
-class Ground;
-
-class UIManager; // forward
-
+/**
+ * @brief Traduit l'entrée d'un tick (InputState) en commandes du joueur (CommandBuffer).
+ *
+ * Ne lit ni la fenêtre ni le clavier : le jeu lui passe l'état de la frame construit par InputSystem,
+ * le rejeu celui d'un enregistrement. Les fronts (appui sur I, E, M...) sont détectés par
+ * rapport à l'entrée du tick précédent.
+ */
 class EventManager {
 public:
-    explicit EventManager(sf::RenderWindow& win);
-    void processEvents(Player &player, std::vector<GameCharacter *> allCharacters, const std::vector<std::unique_ptr<Ground>> &grounds);
+    EventManager() = default;
+    void processEvents(const InputState &input, Player &player, CommandBuffer &commands);
     bool isMapViewActive() const { return showMapView; }
     void toggleMapView() { showMapView = !showMapView; }
+    // L'inventaire ouvert met la simulation en pause
     bool isPaused() const { return paused; }
-    void setPaused(bool state) { paused = state; }
-    bool isInteractPressed() const { return interactPressed; }
 
     // Inventaire
-    void setUIManager(UIManager* ui) { uiManager = ui; }
     bool isInventoryOpen() const { return inventoryOpen; }
+    int getInventorySelection() const { return inventorySelection; }
 
 private:
-    sf::RenderWindow& window;
-    std::vector<std::unique_ptr<Event>> eventQueue;
     bool showMapView = false;
     bool paused = false;
-    bool interactPressed = false;
+
+    // Entrée du tick précédent (détection des fronts)
+    InputState input;
+    InputState previousInput;
+    // Dernière direction au sol : réappliquée en l'air (garde son élan)
+    sf::Vector2f lastGroundDirection{0.f, 0.f};
 
     // Inventory state
-    UIManager* uiManager = nullptr;
     bool inventoryOpen = false;
-    bool iKeyPressed = false;
-    bool leftPressed = false;
-    bool rightPressed = false;
-    bool enterPressed = false;
-    
-    void handleKeyboard(Player& player, float deltaTime, std::vector<GameCharacter *> allCharacters, const std::vector<std::unique_ptr<Ground>> &grounds);
-};
\ No newline at end of file
+    int inventorySelection = 0;
+
+    // Vrai au tick où le bouton passe de relâché à appuyé
+    bool wasPressed(InputButton button) const { return input.isDown(button) && !previousInput.isDown(button); }
+
+    void handleKeyboard(Player& player, float deltaTime, CommandBuffer &commands);
+};
@@ -0,0 +1,12 @@
+#include "GameplayEventBus.hpp"
+
+GameplayEventBus &GameplayEventBus::getInstance()
+{
+    static GameplayEventBus instance;
+    return instance;
+}
+
+void GameplayEventBus::dispatch()
+{
+    std::apply([](auto &...queue) { (queue.dispatch(), ...); }, queues);
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "GameplayEvents.hpp"
+#include "MpscQueue.hpp"
+
+/**
+ * @brief File d'un type d'événement : lot de la frame en cours, plus une file sans verrou pour
+ * les threads de travail, vidée dans le lot au moment de la distribution.
+ */
+template <typename Event>
+class EventQueue
+{
+public:
+    using Handler = std::function<void(const Event &)>;
+
+    static constexpr std::size_t concurrentCapacity = 256;
+
+    // Lots réservés une fois : une frame ordinaire ne fait pas grandir les vecteurs
+    EventQueue()
+    {
+        pending.reserve(64);
+        dispatching.reserve(64);
+    }
+
+    // Abonnement au démarrage (avant toute publication)
+    void subscribe(Handler handler) { handlers.push_back(std::move(handler)); }
+    bool hasSubscribers() const { return !handlers.empty(); }
+
+    // Sans abonné, l'événement est ignoré : le rejeu sans fenêtre (replay) n'accumule rien
+    void publish(Event event)
+    {
+        if (!handlers.empty())
+            pending.push_back(std::move(event));
+    }
+
+    bool publishConcurrent(Event event)
+    {
+        if (handlers.empty())
+            return true;
+        return concurrent.push(std::move(event));
+    }
+
+    void dispatch()
+    {
+        Event event;
+        while (concurrent.pop(event))
+            pending.push_back(std::move(event));
+
+        // Un abonné peut publier pendant la distribution : l'événement part avec le lot suivant
+        dispatching.swap(pending);
+        for (const Event &queued : dispatching)
+            for (const Handler &handler : handlers)
+                handler(queued);
+        dispatching.clear();
+    }
+
+private:
+    std::vector<Handler> handlers;
+    std::vector<Event> pending;
+    std::vector<Event> dispatching;
+    MpscQueue<Event, concurrentCapacity> concurrent;
+};
+
+/**
+ * @brief Bus des événements de jeu : la simulation publie, l'interface, la caméra et la télémétrie
+ * s'abonnent, sans que les systèmes s'appellent directement.
+ *
+ * Les événements publiés pendant un tick sont rangés par type et distribués en lot par dispatch(),
+ * appelé une fois par frame sur le thread de simulation : dans l'ordre des types de la liste
+ * ci-dessous, puis dans l'ordre de publication. publish() est réservé au thread de simulation ;
+ * publishConcurrent() peut être appelé depuis n'importe quel thread (file sans verrou, bornée).
+ */
+class GameplayEventBus
+{
+public:
+    static GameplayEventBus &getInstance();
+
+    template <typename Event>
+    void subscribe(typename EventQueue<Event>::Handler handler) { queue<Event>().subscribe(std::move(handler)); }
+
+    template <typename Event>
+    void publish(Event event) { queue<Event>().publish(std::move(event)); }
+
+    /**
+     * @return false si la file du type est pleine (événement perdu)
+     */
+    template <typename Event>
+    bool publishConcurrent(Event event) { return queue<Event>().publishConcurrent(std::move(event)); }
+
+    /**
+     * @brief Distribue les événements de la frame aux abonnés (thread de simulation)
+     */
+    void dispatch();
+
+private:
+    GameplayEventBus() = default;
+
+    template <typename Event>
+    EventQueue<Event> &queue() { return std::get<EventQueue<Event>>(queues); }
+
+    std::tuple<EventQueue<DamageDealt>,
+               EventQueue<CharacterDied>,
+               EventQueue<AttackStarted>,
+               EventQueue<ChestOpened>,
+               EventQueue<LevelCompleted>,
+               EventQueue<ItemUsed>>
+        queues;
+};
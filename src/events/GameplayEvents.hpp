@@ -0,0 +1,71 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <string>
+#include <vector>
+
+class GameCharacter;
+
+/*
+ * Événements de jeu distribués par GameplayEventBus, une fois par frame.
+ *
+ * Les personnages sont désignés par pointeur pour être comparés (le joueur, par exemple) :
+ * ne pas les déréférencer, un PNJ mort a pu être retiré du niveau avant la distribution.
+ */
+
+/**
+ * @brief Un personnage a reçu des dégâts (GameCharacter::takeDamage)
+ */
+struct DamageDealt
+{
+    const GameCharacter *target = nullptr;
+    int amount = 0;
+    int remainingHp = 0;
+    sf::Vector2f position;
+};
+
+/**
+ * @brief Les points de vie d'un personnage sont tombés à zéro
+ */
+struct CharacterDied
+{
+    const GameCharacter *character = nullptr;
+    sf::Vector2f position;
+};
+
+/**
+ * @brief Un personnage lance une attaque ; les dégâts éventuels arrivent après le délai
+ */
+struct AttackStarted
+{
+    const GameCharacter *attacker = nullptr;
+    float delay = 0.f;
+};
+
+/**
+ * @brief Le joueur a ouvert un coffre : items rangés et items refusés (inventaire plein)
+ */
+struct ChestOpened
+{
+    sf::Vector2f position;
+    int levelCounter = 0;
+    std::vector<std::string> obtained;
+    std::vector<std::string> rejected;
+};
+
+/**
+ * @brief Le joueur a franchi la porte de sortie du niveau
+ */
+struct LevelCompleted
+{
+    int levelCounter = 0; // niveau terminé
+};
+
+/**
+ * @brief Un personnage a utilisé un item de son inventaire
+ */
+struct ItemUsed
+{
+    const GameCharacter *user = nullptr;
+    std::string itemName;
+    int slot = 0;
+};
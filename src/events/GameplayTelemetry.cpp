@@ -0,0 +1,44 @@
+#include "GameplayTelemetry.hpp"
+#include "GameplayEventBus.hpp"
+#include "../profiling/TraceRecorder.hpp"
+
+void GameplayTelemetry::subscribe(GameplayEventBus &bus)
+{
+    bus.subscribe<DamageDealt>([this](const DamageDealt &event)
+    {
+        ++damageEvents;
+        damageTotal += static_cast<std::uint64_t>(event.amount);
+        TRACE_COUNTER("damage_total", damageTotal);
+    });
+    bus.subscribe<CharacterDied>([this](const CharacterDied &)
+    {
+        ++deaths;
+        TRACE_INSTANT("character_died");
+    });
+    bus.subscribe<AttackStarted>([this](const AttackStarted &) { ++attacks; });
+    bus.subscribe<ChestOpened>([this](const ChestOpened &event)
+    {
+        ++chestsOpened;
+        itemsLooted += event.obtained.size();
+        itemsRejected += event.rejected.size();
+        TRACE_INSTANT("chest_opened");
+    });
+    bus.subscribe<LevelCompleted>([this](const LevelCompleted &)
+    {
+        ++levelsCompleted;
+        TRACE_INSTANT("level_completed");
+    });
+    bus.subscribe<ItemUsed>([this](const ItemUsed &)
+    {
+        ++itemsUsed;
+        TRACE_INSTANT("item_used");
+    });
+}
+
+void GameplayTelemetry::report(std::ostream &out) const
+{
+    out << "Session: " << levelsCompleted << " levels completed, "
+        << attacks << " attacks, " << damageEvents << " hits (" << damageTotal << " damage), "
+        << deaths << " deaths, " << chestsOpened << " chests (" << itemsLooted << " items looted, "
+        << itemsRejected << " rejected), " << itemsUsed << " items used\n";
+}
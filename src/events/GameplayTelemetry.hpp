@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+
+class GameplayEventBus;
+
+/**
+ * @brief Abonné télémétrie du bus : compte les événements de la partie et les marque dans la
+ * trace en cours (TraceRecorder) ; report() écrit le bilan en fin de partie.
+ */
+class GameplayTelemetry
+{
+public:
+    void subscribe(GameplayEventBus &bus);
+    void report(std::ostream &out) const;
+
+private:
+    std::uint64_t damageEvents = 0;
+    std::uint64_t damageTotal = 0;
+    std::uint64_t deaths = 0;
+    std::uint64_t attacks = 0;
+    std::uint64_t chestsOpened = 0;
+    std::uint64_t itemsLooted = 0;
+    std::uint64_t itemsRejected = 0;
+    std::uint64_t levelsCompleted = 0;
+    std::uint64_t itemsUsed = 0;
+};
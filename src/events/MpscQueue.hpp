@@ -0,0 +1,99 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief File bornée sans verrou : plusieurs producteurs (threads de travail), un seul consommateur.
+ *
+ * Chaque case porte un numéro de séquence : un producteur réserve une position par
+ * compare-and-swap, écrit la valeur puis publie la séquence ; le consommateur ne lit une case
+ * que lorsque sa séquence indique qu'elle est remplie. Aucune allocation après la construction.
+ *
+ * @note File pleine : push() rend false et l'élément est compté dans getDropped() (jamais d'attente)
+ */
+template <typename T, std::size_t Capacity>
+class MpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacité en puissance de deux");
+
+public:
+    MpscQueue()
+    {
+        for (std::size_t i = 0; i < Capacity; ++i)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue &operator=(const MpscQueue &) = delete;
+
+    /**
+     * @brief Ajoute un élément (tout thread)
+     * @return false si la file est pleine
+     */
+    bool push(T value)
+    {
+        std::size_t position = tail.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot &slot = slots[position & mask];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (difference == 0)
+            {
+                // Case libre à cette position : la réserver
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.value = std::move(value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Le consommateur n'a pas encore libéré la case : file pleine
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                // Un autre producteur a pris la position
+                position = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Retire le plus ancien élément (thread consommateur uniquement)
+     * @return false si la file est vide
+     */
+    bool pop(T &value)
+    {
+        Slot &slot = slots[head & mask];
+        const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != head + 1)
+            return false;
+        value = std::move(slot.value);
+        slot.sequence.store(head + Capacity, std::memory_order_release);
+        ++head;
+        return true;
+    }
+
+    std::uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr std::size_t mask = Capacity - 1;
+
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    std::array<Slot, Capacity> slots;
+    alignas(64) std::atomic<std::size_t> tail{0}; // prochaine position réservée par un producteur
+    alignas(64) std::size_t head = 0;             // prochaine position lue par le consommateur
+    std::atomic<std::uint32_t> dropped{0};
+};
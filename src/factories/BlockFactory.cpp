@@ -4,7 +4,7 @@
 #include <memory>
 #include <iostream>
 
-std::unique_ptr<Block> BlockFactory::createBlocks(BlockType type, int posx, int posy, sf::RenderWindow &window)
+std::unique_ptr<Block> BlockFactory::createBlocks(BlockType type, int posx, int posy, const sf::Vector2u &areaSize)
 {
     std::cerr << "BlockFactory::createBlocks type=" << static_cast<int>(type) << " pos=("<<posx<<","<<posy<<")" << std::endl;
 
@@ -12,45 +12,45 @@ std::unique_ptr<Block> BlockFactory::createBlocks(BlockType type, int posx, int
     {
     case LEFT_EXIT:
         std::cerr << "  -> creating LeftExitBlock\n";
-        return std::make_unique<LeftExitBlock>(posx, posy, window);
+        return std::make_unique<LeftExitBlock>(posx, posy, areaSize);
     case TOP_EXIT:
         std::cerr << "  -> creating TopExitBlock\n";
-        return std::make_unique<TopExitBlock>(posx, posy, window);
+        return std::make_unique<TopExitBlock>(posx, posy, areaSize);
     case RIGHT_EXIT:
         std::cerr << "  -> creating RightExitBlock\n";
-        return std::make_unique<RightExitBlock>(posx, posy, window);
+        return std::make_unique<RightExitBlock>(posx, posy, areaSize);
     case BOTTOM_EXIT:
         std::cerr << "  -> creating BottomExitBlock\n";
-        return std::make_unique<BottomExitBlock>(posx, posy, window);
+        return std::make_unique<BottomExitBlock>(posx, posy, areaSize);
 
     case LEFT_TOP_EXIT:
-        return std::make_unique<LeftTopExitBlock>(posx, posy, window);
+        return std::make_unique<LeftTopExitBlock>(posx, posy, areaSize);
     case LEFT_RIGHT_EXIT:
-        return std::make_unique<LeftRightExitBlock>(posx, posy, window);
+        return std::make_unique<LeftRightExitBlock>(posx, posy, areaSize);
     case LEFT_BOTTOM_EXIT:
-        return std::make_unique<LeftBottomExitBlock>(posx, posy, window);
+        return std::make_unique<LeftBottomExitBlock>(posx, posy, areaSize);
     case TOP_RIGHT_EXIT:
-        return std::make_unique<TopRightExitBlock>(posx, posy, window);
+        return std::make_unique<TopRightExitBlock>(posx, posy, areaSize);
     case TOP_BOTTOM_EXIT:
-        return std::make_unique<TopBottomExitBlock>(posx, posy, window);
+        return std::make_unique<TopBottomExitBlock>(posx, posy, areaSize);
     case RIGHT_BOTTOM_EXIT:
-        return std::make_unique<RightBottomExitBlock>(posx, posy, window);
+        return std::make_unique<RightBottomExitBlock>(posx, posy, areaSize);
 
     case LEFT_TOP_RIGHT_EXIT:
-        return std::make_unique<LeftTopRightExitBlock>(posx, posy, window);
+        return std::make_unique<LeftTopRightExitBlock>(posx, posy, areaSize);
     case LEFT_TOP_BOTTOM_EXIT:
-        return std::make_unique<LeftTopBottomExitBlock>(posx, posy, window);
+        return std::make_unique<LeftTopBottomExitBlock>(posx, posy, areaSize);
     case LEFT_RIGHT_BOTTOM_EXIT:
-        return std::make_unique<LeftRightBottomExitBlock>(posx, posy, window);
+        return std::make_unique<LeftRightBottomExitBlock>(posx, posy, areaSize);
     case TOP_RIGHT_BOTTOM_EXIT:
-        return std::make_unique<TopRightBottomExitBlock>(posx, posy, window);
+        return std::make_unique<TopRightBottomExitBlock>(posx, posy, areaSize);
 
     case LEFT_TOP_RIGHT_BOTTOM_EXIT:
-        return std::make_unique<LeftTopRightBottomExitBlock>(posx, posy, window);
+        return std::make_unique<LeftTopRightBottomExitBlock>(posx, posy, areaSize);
         
     default:
         std::cerr << "  -> unknown BlockType, fallback to LeftExitBlock\n";
         // Fallback: return a simple LeftExitBlock to avoid throwing in this factory
-        return std::make_unique<LeftExitBlock>(posx, posy, window);
+        return std::make_unique<LeftExitBlock>(posx, posy, areaSize);
     }
 }
\ No newline at end of file
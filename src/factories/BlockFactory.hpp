@@ -27,7 +27,7 @@
 
 class BlockFactory {
 public:
-    static std::unique_ptr<Block> createBlocks(BlockType type, int posx, int posy, sf::RenderWindow& window);
+    static std::unique_ptr<Block> createBlocks(BlockType type, int posx, int posy, const sf::Vector2u& areaSize);
 };
 
 #endif
\ No newline at end of file
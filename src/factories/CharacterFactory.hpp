@@ -6,6 +6,7 @@
 #include "../items/ManaPotion.hpp"
 #include "../items/HealthAmulet.hpp"
 #include "../items/DamageAmulet.hpp"
+#include "../resources/TextureAtlas.hpp"
 #include <vector>
 #include <memory>
 
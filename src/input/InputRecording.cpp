@@ -0,0 +1,93 @@
+#include "InputRecording.hpp"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+void InputRecording::append(const InputState &input)
+{
+    if (!runs.empty() && runs.back().buttons == input.buttons)
+        ++runs.back().length;
+    else
+        runs.push_back({input.buttons, 0, 1});
+    ++tickCount;
+}
+
+void InputRecording::expand(std::vector<InputState> &inputs) const
+{
+    inputs.clear();
+    inputs.reserve(tickCount);
+    for (const Run &run : runs)
+        inputs.insert(inputs.end(), run.length, InputState{run.buttons});
+}
+
+bool InputRecording::save(const std::string &path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        std::cerr << "InputRecording: impossible d'écrire " << path << "\n";
+        return false;
+    }
+
+    Header header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.seed = seed;
+    header.areaWidth = areaSize.x;
+    header.areaHeight = areaSize.y;
+    header.tickSeconds = tickSeconds;
+    header.tickCount = tickCount;
+    header.runCount = static_cast<std::uint32_t>(runs.size());
+    header.finalStateHash = finalStateHash;
+
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(runs.data()), static_cast<std::streamsize>(runs.size() * sizeof(Run)));
+    return static_cast<bool>(out);
+}
+
+bool InputRecording::load(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    Header header{};
+    if (!in || !in.read(reinterpret_cast<char *>(&header), sizeof(header)) || std::memcmp(header.magic, magic, sizeof(magic)) != 0)
+    {
+        std::cerr << "InputRecording: " << path << " n'est pas un enregistrement valide\n";
+        return false;
+    }
+
+    // Les tailles lues viennent du fichier : les vérifier avant d'allouer
+    const std::streamoff dataStart = in.tellg();
+    in.seekg(0, std::ios::end);
+    const std::streamoff remaining = in.tellg() - dataStart;
+    in.seekg(dataStart);
+    if (dataStart < 0 || remaining < 0 || header.tickCount > maxTicks || header.runCount > header.tickCount ||
+        static_cast<std::uint64_t>(header.runCount) * sizeof(Run) > static_cast<std::uint64_t>(remaining))
+    {
+        std::cerr << "InputRecording: en-tête incohérent dans " << path << "\n";
+        return false;
+    }
+
+    std::vector<Run> loadedRuns(header.runCount);
+    if (!in.read(reinterpret_cast<char *>(loadedRuns.data()), static_cast<std::streamsize>(loadedRuns.size() * sizeof(Run))))
+    {
+        std::cerr << "InputRecording: entrées tronquées dans " << path << "\n";
+        return false;
+    }
+
+    std::uint64_t ticks = 0;
+    for (const Run &run : loadedRuns)
+        ticks += run.length;
+    if (ticks != header.tickCount)
+    {
+        std::cerr << "InputRecording: nombre de ticks incohérent dans " << path << "\n";
+        return false;
+    }
+
+    seed = header.seed;
+    areaSize = sf::Vector2u(header.areaWidth, header.areaHeight);
+    tickSeconds = header.tickSeconds;
+    finalStateHash = header.finalStateHash;
+    tickCount = header.tickCount;
+    runs = std::move(loadedRuns);
+    return true;
+}
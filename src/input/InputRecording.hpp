@@ -0,0 +1,69 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "InputState.hpp"
+
+/**
+ * @brief Partie enregistrée : graine, taille de zone, pas de simulation et entrées tick par tick.
+ *
+ * Rejouée par GameSession avec les mêmes paramètres, elle redonne exactement le même état final
+ * (finalStateHash), ce qui en fait un benchmark de bout en bout (outil replay).
+ *
+ * Fichier (little-endian) : [Header][Run x runCount], les entrées étant compressées par plages
+ * (un même état de boutons répété sur plusieurs ticks ne prend qu'une entrée).
+ */
+class InputRecording
+{
+public:
+    static constexpr char magic[8] = {'G', 'O', 'T', 'R', 'E', 'C', '1', '\0'};
+    // Au-delà (24 h à 60 ticks/s), un fichier est considéré comme corrompu : rien n'est alloué
+    static constexpr std::uint32_t maxTicks = 24u * 60u * 60u * 60u;
+
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t seed;
+        std::uint32_t areaWidth;
+        std::uint32_t areaHeight;
+        float tickSeconds;
+        std::uint32_t tickCount;
+        std::uint32_t runCount;
+        std::uint64_t finalStateHash; // 0 si inconnu
+    };
+
+    struct Run
+    {
+        std::uint16_t buttons;
+        std::uint16_t reserved;
+        std::uint32_t length; // nombre de ticks
+    };
+
+    static_assert(sizeof(Header) == 40, "Header must stay 40 bytes");
+    static_assert(sizeof(Run) == 8, "Run must stay 8 bytes");
+
+    std::uint32_t seed = 0;
+    sf::Vector2u areaSize;
+    float tickSeconds = 1.f / 60.f;
+    std::uint64_t finalStateHash = 0;
+
+    /**
+     * @brief Ajoute l'entrée d'un tick (n'alloue qu'au changement d'état des boutons)
+     */
+    void append(const InputState &input);
+
+    std::uint32_t getTickCount() const { return tickCount; }
+
+    /**
+     * @brief Entrées tick par tick, décompressées
+     */
+    void expand(std::vector<InputState> &inputs) const;
+
+    bool save(const std::string &path) const;
+    bool load(const std::string &path);
+
+private:
+    std::vector<Run> runs;
+    std::uint32_t tickCount = 0;
+};
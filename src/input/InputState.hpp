@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Boutons de jeu, indépendants des touches physiques (voir InputSystem)
+ */
+enum class InputButton : std::uint8_t
+{
+    MoveLeft,    // Q
+    MoveRight,   // D
+    Up,          // Z : saut, montée d'échelle
+    Down,        // S : descente d'échelle
+    AttackLeft,  // flèche gauche (sélection précédente dans l'inventaire)
+    AttackRight, // flèche droite (sélection suivante dans l'inventaire)
+    Interact,    // E
+    Map,         // M
+    Dash,        // Espace
+    Inventory,   // I
+    Confirm,     // Entrée : utiliser l'item sélectionné
+    Count
+};
+
+/**
+ * @brief État des boutons pendant un tick de simulation : c'est la seule entrée du joueur
+ * que lit la simulation, ce qui permet d'enregistrer puis de rejouer une partie.
+ */
+struct InputState
+{
+    std::uint16_t buttons = 0;
+
+    static_assert(static_cast<int>(InputButton::Count) <= 16, "un bit par bouton");
+
+    bool isDown(InputButton button) const { return (buttons >> static_cast<int>(button)) & 1u; }
+
+    void set(InputButton button, bool down)
+    {
+        const std::uint16_t bit = static_cast<std::uint16_t>(1u << static_cast<int>(button));
+        buttons = down ? static_cast<std::uint16_t>(buttons | bit) : static_cast<std::uint16_t>(buttons & ~bit);
+    }
+
+    bool operator==(const InputState &other) const { return buttons == other.buttons; }
+    bool operator!=(const InputState &other) const { return buttons != other.buttons; }
+};
@@ -0,0 +1,165 @@
+#include "InputSystem.hpp"
+#include <SFML/Window/Event.hpp>
+
+InputSystem::InputSystem()
+{
+    buttonBindings.fill(InputButton::Count);
+    actionBindings.fill(UiAction::Count);
+    events.reserve(32);
+
+    bind(sf::Keyboard::Q, InputButton::MoveLeft);
+    bind(sf::Keyboard::D, InputButton::MoveRight);
+    bind(sf::Keyboard::Z, InputButton::Up);
+    bind(sf::Keyboard::S, InputButton::Down);
+    bind(sf::Keyboard::Left, InputButton::AttackLeft);
+    bind(sf::Keyboard::Right, InputButton::AttackRight);
+    bind(sf::Keyboard::E, InputButton::Interact);
+    bind(sf::Keyboard::M, InputButton::Map);
+    bind(sf::Keyboard::Space, InputButton::Dash);
+    bind(sf::Keyboard::I, InputButton::Inventory);
+    bind(sf::Keyboard::Enter, InputButton::Confirm);
+
+    bind(sf::Keyboard::Escape, UiAction::Pause);
+    bind(sf::Keyboard::Up, UiAction::MenuUp);
+    bind(sf::Keyboard::Down, UiAction::MenuDown);
+    bind(sf::Keyboard::Enter, UiAction::MenuConfirm);
+    bind(sf::Keyboard::F3, UiAction::ToggleProfiler);
+    bind(sf::Keyboard::F9, UiAction::DumpProfile);
+    bind(sf::Keyboard::F10, UiAction::ToggleTrace);
+}
+
+void InputSystem::bind(sf::Keyboard::Key key, InputButton button)
+{
+    if (key >= 0 && key < static_cast<int>(keyCount))
+        buttonBindings[key] = button;
+}
+
+void InputSystem::bind(sf::Keyboard::Key key, UiAction action)
+{
+    if (key >= 0 && key < static_cast<int>(keyCount))
+        actionBindings[key] = action;
+}
+
+void InputSystem::pump(sf::Window &window, bool waitForEvent)
+{
+    // Fronts et événements de la frame précédente
+    pressed = InputState();
+    released = InputState();
+    actionsPressed.reset();
+    keysPressed.reset();
+    events.clear();
+    closeRequested = false;
+    keyEventSeen = false;
+
+    sf::Event event;
+    bool hasEvent = waitForEvent ? window.waitEvent(event) : window.pollEvent(event);
+    for (; hasEvent; hasEvent = window.pollEvent(event))
+        handleEvent(event, Clock::now());
+}
+
+void InputSystem::handleEvent(const sf::Event &event, Clock::time_point time)
+{
+    switch (event.type)
+    {
+    case sf::Event::KeyPressed:
+        setKey(event.key.code, true, time);
+        break;
+    case sf::Event::KeyReleased:
+        setKey(event.key.code, false, time);
+        break;
+    case sf::Event::Closed:
+        closeRequested = true;
+        events.push_back({InputEvent::Type::Closed, sf::Keyboard::Unknown, time});
+        break;
+    case sf::Event::LostFocus:
+        focused = false;
+        // Les relâchements faits hors de la fenêtre ne seront pas reçus
+        releaseAll(time);
+        events.push_back({InputEvent::Type::LostFocus, sf::Keyboard::Unknown, time});
+        break;
+    case sf::Event::GainedFocus:
+        focused = true;
+        events.push_back({InputEvent::Type::GainedFocus, sf::Keyboard::Unknown, time});
+        break;
+    default:
+        break;
+    }
+}
+
+void InputSystem::setKey(sf::Keyboard::Key key, bool down, Clock::time_point time)
+{
+    if (key < 0 || key >= static_cast<int>(keyCount))
+        return;
+    // Répétition automatique de l'OS : pas un nouveau front
+    if (keysDown.test(key) == down)
+        return;
+    keysDown.set(key, down);
+    if (down)
+        keysPressed.set(key);
+    else
+        consumedKeys.reset(key);
+    events.push_back({down ? InputEvent::Type::KeyPressed : InputEvent::Type::KeyReleased, key, time});
+
+    const InputButton button = buttonBindings[key];
+    const UiAction action = actionBindings[key];
+    if (button == InputButton::Count && action == UiAction::Count)
+        return;
+
+    if (!keyEventSeen)
+    {
+        keyEventSeen = true;
+        firstKeyEventTime = time;
+    }
+
+    if (action != UiAction::Count && down)
+        actionsPressed.set(static_cast<std::size_t>(action));
+
+    if (button == InputButton::Count)
+        return;
+    const bool wasHeld = held.isDown(button);
+    held.set(button, isButtonHeld(button));
+    if (!wasHeld && held.isDown(button))
+        pressed.set(button, true);
+    else if (wasHeld && !held.isDown(button))
+        released.set(button, true);
+}
+
+bool InputSystem::isButtonHeld(InputButton button) const
+{
+    for (std::size_t key = 0; key < keyCount; ++key)
+        if (keysDown.test(key) && !consumedKeys.test(key) && buttonBindings[key] == button)
+            return true;
+    return false;
+}
+
+void InputSystem::consume(UiAction action)
+{
+    for (std::size_t key = 0; key < keyCount; ++key)
+    {
+        if (actionBindings[key] != action || !keysPressed.test(key))
+            continue;
+        const InputButton button = buttonBindings[key];
+        if (keysDown.test(key))
+            consumedKeys.set(key);
+        if (button == InputButton::Count)
+            continue;
+        // Un appui bref (déjà relâché) ne compte plus non plus comme appui de la frame
+        held.set(button, isButtonHeld(button));
+        if (!held.isDown(button))
+            pressed.set(button, false);
+    }
+}
+
+void InputSystem::releaseAll(Clock::time_point time)
+{
+    for (std::size_t key = 0; key < keyCount; ++key)
+        if (keysDown.test(key))
+            setKey(static_cast<sf::Keyboard::Key>(key), false, time);
+}
+
+InputState InputSystem::getState() const
+{
+    InputState state;
+    state.buttons = static_cast<std::uint16_t>(held.buttons | pressed.buttons);
+    return state;
+}
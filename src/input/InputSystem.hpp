@@ -0,0 +1,124 @@
+#pragma once
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Window.hpp>
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "InputState.hpp"
+
+/**
+ * @brief Actions hors simulation : menus, profiler et trace (jamais enregistrées dans un InputRecording)
+ */
+enum class UiAction : std::uint8_t
+{
+    Pause,
+    MenuUp,
+    MenuDown,
+    MenuConfirm,
+    ToggleProfiler,
+    DumpProfile,
+    ToggleTrace,
+    Count
+};
+
+/**
+ * @brief Événement de la fenêtre retenu pour la frame, horodaté à sa sortie de la file de SFML
+ */
+struct InputEvent
+{
+    enum class Type : std::uint8_t
+    {
+        KeyPressed,
+        KeyReleased,
+        Closed,
+        LostFocus,
+        GainedFocus
+    };
+
+    Type type;
+    sf::Keyboard::Key key = sf::Keyboard::Unknown;
+    std::chrono::steady_clock::time_point time;
+};
+
+/**
+ * @brief Seule source d'entrée du jeu : vide la file d'événements de la fenêtre une fois par frame.
+ *
+ * Les touches sont traduites par une table de correspondance en boutons de jeu (InputButton) et en
+ * actions d'interface (UiAction). L'état maintenu des touches est déduit des événements eux-mêmes :
+ * un appui bref, commencé et fini entre deux frames, apparaît quand même dans l'entrée du tick.
+ *
+ * Fronts (wasPressed / wasReleased) et événements valent pour toute la frame, jusqu'au pump() suivant.
+ */
+class InputSystem
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Correspondances par défaut (clavier AZERTY) : ZQSD, flèches, E, M, Espace, I, Entrée, Échap, F3, F9, F10
+     */
+    InputSystem();
+
+    void bind(sf::Keyboard::Key key, InputButton button);
+    void bind(sf::Keyboard::Key key, UiAction action);
+
+    /**
+     * @brief Vide la file d'événements de la fenêtre et met à jour l'état de la frame
+     * @param waitForEvent Bloque jusqu'au premier événement (fenêtre sans focus)
+     */
+    void pump(sf::Window &window, bool waitForEvent = false);
+
+    /**
+     * @brief Entrée du tick : boutons maintenus, plus ceux appuyés pendant la frame (appuis brefs)
+     */
+    InputState getState() const;
+
+    bool isDown(InputButton button) const { return held.isDown(button); }
+    bool wasPressed(InputButton button) const { return pressed.isDown(button); }
+    bool wasReleased(InputButton button) const { return released.isDown(button); }
+    bool wasPressed(UiAction action) const { return actionsPressed.test(static_cast<std::size_t>(action)); }
+
+    /**
+     * @brief Réserve à l'interface les touches de l'action appuyées pendant la frame : leurs boutons
+     * de jeu (Entrée : Confirm et MenuConfirm) disparaissent de getState() jusqu'au relâchement
+     */
+    void consume(UiAction action);
+
+    bool isCloseRequested() const { return closeRequested; }
+    bool hasFocus() const { return focused; }
+
+    // Événements de la dernière frame, dans l'ordre de la file
+    const std::vector<InputEvent> &getEvents() const { return events; }
+
+    // Premier appui ou relâchement d'une touche liée pendant la frame (latence entrée -> affichage)
+    bool hasKeyEvent() const { return keyEventSeen; }
+    Clock::time_point getFirstKeyEventTime() const { return firstKeyEventTime; }
+
+private:
+    static constexpr std::size_t keyCount = sf::Keyboard::KeyCount;
+
+    std::array<InputButton, keyCount> buttonBindings;
+    std::array<UiAction, keyCount> actionBindings;
+
+    std::bitset<keyCount> keysDown;
+    std::bitset<keyCount> keysPressed;  // appuyées pendant la frame (même relâchées depuis)
+    std::bitset<keyCount> consumedKeys; // prises par une action d'interface, ignorées jusqu'au relâchement
+    InputState held;
+    InputState pressed;
+    InputState released;
+    std::bitset<static_cast<std::size_t>(UiAction::Count)> actionsPressed;
+
+    std::vector<InputEvent> events;
+    bool closeRequested = false;
+    bool focused = true;
+    bool keyEventSeen = false;
+    Clock::time_point firstKeyEventTime;
+
+    void handleEvent(const sf::Event &event, Clock::time_point time);
+    void setKey(sf::Keyboard::Key key, bool down, Clock::time_point time);
+    // Un bouton reste maintenu tant qu'une des touches qui lui sont liées l'est
+    bool isButtonHeld(InputButton button) const;
+    void releaseAll(Clock::time_point time);
+};
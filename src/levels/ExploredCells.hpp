@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Cellules explorées d'un niveau (vue carte), indexées ligne * colonnes + colonne.
+ *
+ * Dimensionné à la génération du niveau (GameLevel::generate) : un bit par cellule, quelle que
+ * soit la taille du labyrinthe. La copie dans un instantané de même taille réutilise sa mémoire.
+ */
+class ExploredCells
+{
+public:
+    void resize(std::size_t cells) { bits.assign(cells, false); }
+    std::size_t size() const { return bits.size(); }
+
+    bool test(std::size_t cell) const { return cell < bits.size() && bits[cell]; }
+    void set(std::size_t cell)
+    {
+        if (cell < bits.size())
+            bits[cell] = true;
+    }
+
+    bool operator==(const ExploredCells &other) const { return bits == other.bits; }
+    bool operator!=(const ExploredCells &other) const { return bits != other.bits; }
+
+private:
+    std::vector<bool> bits;
+};
@@ -0,0 +1,126 @@
+#include "GameLevel.hpp"
+#include "../blocks/BlockTypeUtils.hpp"
+#include "../blocks/ExitBlock.hpp"
+#include "../factories/BlockFactory.hpp"
+#include "../characters/Player.hpp"
+#include "../characters/NonPlayer.hpp"
+#include "../events/CommandBuffer.hpp"
+#include "../profiling/FrameProfiler.hpp"
+#include "../profiling/TraceRecorder.hpp"
+#include <algorithm>
+#include <cmath>
+
+GameLevel GameLevel::generate(const sf::Vector2u &areaSize, int columns, int rows)
+{
+    PROFILE_SCOPE(LevelGeneration);
+
+    GameLevel level;
+    level.columns = columns;
+    level.rows = rows;
+    level.explored.resize(static_cast<std::size_t>(columns) * rows);
+
+    level.mazeGenerator = std::make_unique<ModelGenerator>(columns, rows);
+
+    for (Node *n : level.mazeGenerator->getGrid())
+    {
+        BlockType t = getBlockTypeFromNode(n);
+        std::unique_ptr<Block> tile = BlockFactory::createBlocks(t, n->getxPos(), n->getyPos(), areaSize);
+        level.blocks.push_back(std::move(tile));
+
+        auto created = level.blocks.back()->createGrounds();
+        for (auto &g : created)
+            level.grounds.push_back(std::move(g));
+
+        auto objects = level.blocks.back()->createObjects();
+        for (auto &obj : objects)
+            level.gameObjects.push_back(std::move(obj));
+
+        auto characters = level.blocks.back()->createCharacters();
+        for (auto &character : characters)
+            level.spawnedCharacters.push_back(std::move(character));
+    }
+
+    // Une cellule du labyrinthe = un bloc (la zone couvre ExitBlock::GRID_COLS x GRID_ROWS blocs)
+    level.cellSize = sf::Vector2f(static_cast<float>(areaSize.x) / ExitBlock::GRID_COLS,
+                                  static_cast<float>(areaSize.y) / ExitBlock::GRID_ROWS);
+    level.visibilityGrid = VisibilityGrid(level.cellSize, columns, rows);
+    level.visibilityGrid.bucketObjects(level.gameObjects);
+
+    return level;
+}
+
+void GameLevel::step(float deltaTime, Player &player, std::vector<GameCharacter *> &characters, CommandBuffer &commands)
+{
+    // Les PNJ (ennemis) décident : leurs commandes rejoignent celles déjà émises pour ce tick
+    {
+        PROFILE_SCOPE(AI);
+        for (auto *character : characters)
+        {
+            if (!character->isAlive())
+                continue;
+            if (NonPlayer *npc = dynamic_cast<NonPlayer *>(character))
+                npc->updateBehavior(deltaTime, &player, grounds, commands);
+        }
+    }
+
+    {
+        TRACE_SCOPE("commands");
+        CommandContext context{characters, grounds};
+        commands.execute(context);
+    }
+
+    // Gravité, déplacements et collisions avec les sols ; sans partition spatiale, chaque
+    // personnage mis à jour teste tous les sols du niveau (checkAllCollisions)
+    std::size_t groundTests = 0;
+    for (auto *character : characters)
+    {
+        if (!character->isAlive())
+            continue;
+        character->update(deltaTime, grounds);
+        groundTests += grounds.size();
+    }
+
+    characters.erase(
+        std::remove_if(characters.begin(), characters.end(),
+                       [](GameCharacter *c)
+                       { return !c->isAlive() && dynamic_cast<NonPlayer *>(c); }),
+        characters.end());
+
+    // Trace : PNJ restants, et tests contre les sols faits par la physique de ce tick
+    // (PNJ morts pendant le tick compris)
+    TRACE_COUNTER("npcs", characters.size() - 1);
+    TRACE_COUNTER("grounds_tested", groundTests);
+
+    // Character-vs-character collisions: stronger pushes weaker; equal strength -> no movement
+    {
+        PROFILE_SCOPE(Collisions);
+        for (size_t i = 0; i < characters.size(); ++i)
+        {
+            for (size_t j = i + 1; j < characters.size(); ++j)
+            {
+                GameCharacter *a = characters[i];
+                GameCharacter *b = characters[j];
+                if (a->isAlive() && b->isAlive())
+                {
+                    a->resolveCollisionWithCharacter(*b, grounds);
+                }
+            }
+        }
+    }
+
+    // Cellules explorées de la carte (mise à jour seulement au changement de cellule)
+    markExplored(player.getPosition());
+}
+
+bool GameLevel::markExplored(const sf::Vector2f &worldPosition)
+{
+    int col = static_cast<int>(std::floor(worldPosition.x / cellSize.x));
+    int row = static_cast<int>(std::floor(worldPosition.y / cellSize.y));
+    if (col < 0 || row < 0 || col >= columns || row >= rows)
+        return false;
+    size_t index = static_cast<size_t>(row * columns + col);
+    if (index >= explored.size() || explored.test(index))
+        return false;
+    explored.set(index);
+    return true;
+}
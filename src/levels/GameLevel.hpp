@@ -0,0 +1,62 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+#include "ExploredCells.hpp"
+#include "../blocks/Block.hpp"
+#include "../environnement/Ground.hpp"
+#include "../environnement/ModelGenerator.hpp"
+#include "../environnement/VisibilityGrid.hpp"
+#include "../objects/Object.hpp"
+#include "../characters/GameCharacter.hpp"
+
+struct LevelVisuals;
+class CommandBuffer;
+class Player;
+
+/**
+ * @brief Structure pour encapsuler les données du niveau
+ *
+ * Ne contient que l'état de simulation (labyrinthe, sols, objets, personnages) : un niveau
+ * peut être généré et simulé sans fenêtre. Les visuels sont construits à part par le jeu.
+ */
+struct GameLevel
+{
+    static constexpr int mazeColumns = 14;
+    static constexpr int mazeRows = 8;
+
+    int columns = mazeColumns; // dimensions du labyrinthe en cellules
+    int rows = mazeRows;
+    std::vector<std::unique_ptr<Block>> blocks;
+    std::vector<std::unique_ptr<Ground>> grounds;
+    VisibilityGrid visibilityGrid;
+    std::shared_ptr<LevelVisuals> visuals; // décor statique et carte, partagés avec le thread de rendu (nullptr sans rendu)
+    ExploredCells explored;                // cellules explorées (carte)
+    sf::Vector2f cellSize{1.f, 1.f};       // taille d'une cellule du labyrinthe en coordonnées monde
+    std::vector<std::unique_ptr<Object>> gameObjects;
+    std::vector<std::unique_ptr<GameCharacter>> spawnedCharacters;
+    std::unique_ptr<ModelGenerator> mazeGenerator;
+
+    /**
+     * @brief Génère un nouveau niveau (labyrinthe, blocs, sols, objets et personnages)
+     * @param areaSize Taille de la zone couverte par ExitBlock::GRID_COLS x GRID_ROWS blocs (la fenêtre en jeu)
+     * @param columns Nombre de cellules du labyrinthe en largeur
+     * @param rows Nombre de cellules du labyrinthe en hauteur
+     * @return GameLevel Les données du nouveau niveau
+     */
+    static GameLevel generate(const sf::Vector2u &areaSize, int columns = mazeColumns, int rows = mazeRows);
+
+    /**
+     * @brief Fait avancer la simulation d'un tick : commandes de l'IA, exécution des commandes en attente
+     * (IA et celles déjà émises), physique, retrait des PNJ morts, collisions entre personnages, cellules explorées
+     * @param characters Tous les personnages du niveau, joueur compris (les PNJ morts en sont retirés)
+     * @param commands Tampon du tick, vidé par l'exécution
+     */
+    void step(float deltaTime, Player &player, std::vector<GameCharacter *> &characters, CommandBuffer &commands);
+
+    /**
+     * @brief Marque comme explorée la cellule contenant une position du monde
+     * @return true si la cellule vient d'être découverte
+     */
+    bool markExplored(const sf::Vector2f &worldPosition);
+};
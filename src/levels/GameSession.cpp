@@ -0,0 +1,175 @@
+#include "GameSession.hpp"
+#include "../factories/CharacterFactory.hpp"
+#include "../items/HealthPotion.hpp"
+#include "../objects/Chest.hpp"
+#include "../objects/Door.hpp"
+#include "../events/GameplayEventBus.hpp"
+#include "../profiling/FrameProfiler.hpp"
+#include "../profiling/TraceRecorder.hpp"
+#include <cstring>
+
+GameSession::GameSession(const sf::Vector2u &areaSize, LevelVisualsBuilder buildVisuals)
+    : areaSize(areaSize), buildVisuals(std::move(buildVisuals))
+{
+    player = CharacterFactory::createPlayer(areaSize);
+    // Potions de départ dans l'inventaire du joueur
+    player->addItem(std::make_unique<HealthPotion>(20));
+    player->addItem(std::make_unique<HealthPotion>(20));
+    player->addItem(std::make_unique<HealthPotion>(50));
+
+    level = GameLevel::generate(areaSize);
+    if (this->buildVisuals)
+        this->buildVisuals(level);
+
+    characters.push_back(player.get());
+    for (auto &character : level.spawnedCharacters)
+        characters.push_back(character.get());
+}
+
+void GameSession::tick(const InputState &input, float deltaTime)
+{
+    // Commandes du joueur, exécutées avant la recherche du coffre et de la porte (interaction)
+    bool interactRequested = false;
+    {
+        PROFILE_SCOPE(Input);
+        events.processEvents(input, *player, commands);
+        CommandContext context{characters, level.grounds};
+        commands.execute(context);
+        interactRequested = context.interactRequested;
+    }
+
+    // Coffre et porte sous le joueur (mêmes bornes pour les deux tests)
+    const sf::FloatRect playerBounds = player->getBounds();
+    nearbyChest = nullptr;
+    for (auto &object : level.gameObjects)
+    {
+        if (Chest *chest = dynamic_cast<Chest *>(object.get()))
+        {
+            if (!chest->getIsOpened() && chest->isPlayerOnChest(playerBounds))
+            {
+                nearbyChest = chest;
+                break;
+            }
+        }
+    }
+
+    // Ouvrir le coffre si E est pressé
+    if (interactRequested && nearbyChest != nullptr)
+        openNearbyChest();
+
+    nearbyDoor = nullptr;
+    for (auto &object : level.gameObjects)
+    {
+        if (Door *door = dynamic_cast<Door *>(object.get()))
+        {
+            if (door->isPlayerOnDoor(playerBounds))
+            {
+                nearbyDoor = door;
+                break;
+            }
+        }
+    }
+
+    // Transitionner vers le niveau suivant si E est pressé sur la exitDoor
+    if (interactRequested && nearbyDoor != nullptr && nearbyDoor->getDoorType() == Door::DoorType::ExitDoor)
+        enterNewLevel();
+
+    // L'inventaire met aussi le jeu en pause (EventManager::isPaused)
+    if (!events.isPaused())
+    {
+        // Update : comportements, physique, collisions entre personnages, carte explorée
+        level.step(deltaTime, *player, characters, commands);
+    }
+}
+
+void GameSession::openNearbyChest()
+{
+    nearbyChest->open();
+    ChestOpened opened;
+    opened.position = nearbyChest->getPosition();
+    opened.levelCounter = levelCounter;
+    auto loot = nearbyChest->generateLoot(levelCounter);
+    for (auto &itemPtr : loot)
+    {
+        std::string name = itemPtr->getName();
+        if (player->addItem(std::move(itemPtr)))
+            opened.obtained.push_back(name);
+        else
+            opened.rejected.push_back(name);
+    }
+    // Notifications du butin : abonnés du bus
+    GameplayEventBus::getInstance().publish(std::move(opened));
+}
+
+void GameSession::enterNewLevel()
+{
+    TRACE_INSTANT("level_transition");
+    // Les pointeurs vers l'ancien niveau ne sont plus valides
+    nearbyChest = nullptr;
+    nearbyDoor = nullptr;
+
+    GameplayEventBus::getInstance().publish(LevelCompleted{levelCounter});
+    level = GameLevel::generate(areaSize);
+    if (buildVisuals)
+        buildVisuals(level);
+    levelCounter++;
+
+    // Réinitialiser la liste des personnages avec ceux du nouveau niveau
+    characters.clear();
+    characters.push_back(player.get());
+    for (auto &character : level.spawnedCharacters)
+        characters.push_back(character.get());
+
+    // Repositionner le joueur à la startDoor
+    // La startDoor est à la position (0, 7), ce qui correspond au bas à gauche
+    player->setPosition(20.f, 256.f * 8);
+}
+
+std::uint64_t GameSession::computeStateHash() const
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void *data, std::size_t size)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    };
+    auto mixInt = [&mix](std::int64_t value) { mix(&value, sizeof(value)); };
+    // Les flottants sont pris bit à bit : un écart d'un ulp change l'empreinte
+    auto mixVector = [&mix](const sf::Vector2f &value)
+    {
+        std::uint32_t bits[2];
+        std::memcpy(&bits[0], &value.x, sizeof(float));
+        std::memcpy(&bits[1], &value.y, sizeof(float));
+        mix(bits, sizeof(bits));
+    };
+
+    mixInt(levelCounter);
+    mixInt(static_cast<std::int64_t>(characters.size()));
+    for (const GameCharacter *character : characters)
+    {
+        mixVector(character->getPosition());
+        mixVector(character->getVelocity());
+        mixInt(character->getHp());
+        mixInt(character->getMana());
+        mixInt(character->getEndurance());
+        mixInt(character->isAlive());
+    }
+
+    for (const auto &slot : player->getInventory())
+    {
+        mix(slot.itemTypeName.data(), slot.itemTypeName.size());
+        mixInt(static_cast<std::int64_t>(slot.stack.size()));
+    }
+
+    for (const auto &object : level.gameObjects)
+        if (const Chest *chest = dynamic_cast<const Chest *>(object.get()))
+            mixInt(chest->getIsOpened());
+
+    for (std::size_t cell = 0; cell < level.explored.size(); ++cell)
+        mixInt(level.explored.test(cell));
+    return hash;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "GameLevel.hpp"
+#include "../characters/Player.hpp"
+#include "../events/EventManager.hpp"
+#include "../input/InputState.hpp"
+
+class Chest;
+class Door;
+
+/**
+ * @brief Partie en cours : niveau, joueur et personnages, avancés tick par tick à partir de l'entrée du joueur.
+ *
+ * Ne dépend ni de la fenêtre ni du clavier : le jeu lui passe l'état des touches (InputSystem),
+ * l'outil replay celui d'un enregistrement (InputRecording). Avec la même graine (GameRandom),
+ * la même taille de zone, le même pas et les mêmes entrées, deux sessions arrivent au même état
+ * (computeStateHash).
+ */
+class GameSession
+{
+public:
+    // Construit les visuels d'un niveau qui vient d'être généré (jeu uniquement ; rien sans rendu)
+    using LevelVisualsBuilder = std::function<void(GameLevel &)>;
+
+    /**
+     * @brief Crée le joueur (avec ses potions de départ) et génère le premier niveau
+     * @param areaSize Taille de la zone couverte par un niveau (la fenêtre en jeu)
+     */
+    explicit GameSession(const sf::Vector2u &areaSize, LevelVisualsBuilder buildVisuals = nullptr);
+
+    /**
+     * @brief Un tick : entrée du joueur, coffre et porte à portée, puis simulation du niveau
+     * (sauf inventaire ouvert). Coffre ouvert, niveau terminé, dégâts... sont publiés sur
+     * GameplayEventBus, distribués par le jeu après le tick.
+     */
+    void tick(const InputState &input, float deltaTime);
+
+    Player &getPlayer() { return *player; }
+    const Player &getPlayer() const { return *player; }
+    GameLevel &getLevel() { return level; }
+    const GameLevel &getLevel() const { return level; }
+    const std::vector<GameCharacter *> &getCharacters() const { return characters; }
+    const EventManager &getEvents() const { return events; }
+    int getLevelCounter() const { return levelCounter; }
+
+    // Coffre fermé et porte sous le joueur au dernier tick (hints "[E]")
+    Chest *getNearbyChest() const { return nearbyChest; }
+    Door *getNearbyDoor() const { return nearbyDoor; }
+
+    /**
+     * @brief Empreinte (FNV-1a 64 bits) de l'état de simulation : niveau, joueur, inventaire,
+     * personnages, coffres ouverts et cellules explorées
+     */
+    std::uint64_t computeStateHash() const;
+
+private:
+    sf::Vector2u areaSize;
+    LevelVisualsBuilder buildVisuals;
+    std::unique_ptr<Player> player;
+    GameLevel level;
+    std::vector<GameCharacter *> characters; // joueur puis PNJ du niveau
+    EventManager events;
+    CommandBuffer commands; // commandes du joueur puis de l'IA, réutilisé d'un tick à l'autre
+    int levelCounter = 1;
+
+    Chest *nearbyChest = nullptr;
+    Door *nearbyDoor = nullptr;
+
+    void enterNewLevel();
+    void openNearbyChest();
+};
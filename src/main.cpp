@@ -2,6 +2,10 @@
 #define GAME_OF_THOMAS_MAIN_HPP
 
 #include <SFML/Graphics.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <vector>
 #include <memory>
@@ -25,67 +29,97 @@
 #include "./environnement/Node.hpp"
 #include "./objects/Chest.hpp"
 #include "./objects/Door.hpp"
+#include "./resources/TextureAtlas.hpp"
+#include "./resources/AssetLoader.hpp"
+#include "./resources/FontService.hpp"
+#include "./environnement/StaticGeometry.hpp"
+#include "./environnement/VisibilityGrid.hpp"
+#include "./rendering/SpriteBatch.hpp"
+#include "./rendering/ChunkCache.hpp"
+#include "./rendering/RenderSnapshot.hpp"
+#include "./rendering/RenderThread.hpp"
+#include "./ui/Minimap.hpp"
+#include "./levels/GameLevel.hpp"
+#include "./blocks/ExitBlock.hpp"
+#include "./profiling/FrameProfiler.hpp"
+#include "./profiling/TraceRecorder.hpp"
+#include "./core/GameRandom.hpp"
+#include "./input/InputRecording.hpp"
+#include "./input/InputSystem.hpp"
+#include "./events/GameplayEventBus.hpp"
+#include "./events/GameplayTelemetry.hpp"
+#include "./levels/GameSession.hpp"
 #include <iostream>
 
 /**
- * @brief Structure pour encapsuler les données du niveau
+ * @brief Construit les visuels d'un niveau qui vient d'être généré (appelé par GameSession)
+ * @param level Le nouveau niveau
+ * @param background Le fond du niveau (rendu avec le décor statique dans le cache de tuiles)
  */
-struct GameLevel
+void buildLevelVisuals(GameLevel& level, const sf::Sprite& background)
 {
-    std::vector<std::unique_ptr<Block>> blocks;
-    std::vector<std::unique_ptr<Ground>> grounds;
-    std::vector<std::unique_ptr<Object>> gameObjects;
-    std::vector<std::unique_ptr<GameCharacter>> spawnedCharacters;
-    std::unique_ptr<ModelGenerator> mazeGenerator;
-};
+    PROFILE_SCOPE(LevelGeneration);
 
-/**
- * @brief Génère un nouveau niveau
- * @param window La fenêtre de rendu
- * @return GameLevel Les données du nouveau niveau
- */
-GameLevel generateNewLevel(sf::RenderWindow& window)
-{
-    GameLevel level;
-    
-    level.mazeGenerator = std::make_unique<ModelGenerator>(14, 8);
-    
-    for (Node *n : level.mazeGenerator->getGrid())
-    {
-        BlockType t = getBlockTypeFromNode(n);
-        std::unique_ptr<Block> tile = BlockFactory::createBlocks(t, n->getxPos(), n->getyPos(), window);
-        level.blocks.push_back(std::move(tile));
+    level.visuals = std::make_shared<LevelVisuals>();
 
-        auto created = level.blocks.back()->createGrounds();
-        for (auto &g : created)
-            level.grounds.push_back(std::move(g));
+    // Les sols ne bougent plus : un lot de sommets par texture, rangé par cellule
+    level.visuals->staticGeometry.build(level.grounds, level.visibilityGrid);
 
-        auto objects = level.blocks.back()->createObjects();
-        for (auto &obj : objects)
-            level.gameObjects.push_back(std::move(obj));
+    // Carte de la vue M, générée depuis les masques de murs
+    level.visuals->minimap.build(level.mazeGenerator->getGrid(), level.columns, level.rows, level.cellSize, level.gameObjects);
 
-        auto characters = level.blocks.back()->createCharacters();
-        for (auto &character : characters)
-            level.spawnedCharacters.push_back(std::move(character));
-    }
-    
-    return level;
+    // Fond + murs + échelles rendus à la demande dans des tuiles (pool borné autour de la vue) : une frame ne compose que les tuiles visibles
+    sf::Vector2f worldSize(level.cellSize.x * level.columns, level.cellSize.y * level.rows);
+    const StaticGeometry &geometry = level.visuals->staticGeometry;
+    level.visuals->chunkCache.build(worldSize, [&background, &geometry](sf::RenderTarget &target)
+                           {
+        CullingStats ignored;
+        target.draw(background);
+        geometry.draw(target, ignored); });
 }
 
-// Pour accès global à l'UIManager dans EventManager
-UIManager* gUIManager = nullptr;
-
-int main()
+int main(int argc, char **argv)
 {
+    sf::Clock startupClock;
+
+    // Enregistrement de la partie (entrées + graine) pour l'outil replay : main --record partie.rec [--seed N]
+    std::string recordPath;
+    std::uint32_t seed = GameRandom::makeSeed();
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!std::strcmp(argv[i], "--record") && i + 1 < argc)
+            recordPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--seed") && i + 1 < argc)
+            seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--record <partie.rec>] [--seed <N>]\n";
+            return 1;
+        }
+    }
+
+    // Trace Chrome/Perfetto dès le lancement (chargement compris) : GAME_TRACE=<fichier.json>
+    TRACE_THREAD_NAME("main");
+#ifdef GAME_PROFILING
+    if (const char *tracePath = std::getenv("GAME_TRACE"))
+        TraceRecorder::getInstance().start(tracePath);
+#endif
+
+    //---------------------------------
+    // Décodage des assets en tâche de fond (pendant la création de la fenêtre)
+    //---------------------------------
+    TextureAtlas::prefetchDefault();
+    AssetLoader::getInstance().requestFile("fonts/RobotoMono-Regular.ttf");
+
     sf::RenderWindow window(sf::VideoMode::getDesktopMode(), "Game of Thomas", sf::Style::Fullscreen);
     window.setFramerateLimit(60);
     window.setVerticalSyncEnabled(true);
 
     //---------------------------------
-    // Chargement de la police pour les hints
+    // Police partagée de l'UI (glyphes préchargés pour toutes les tailles)
     //---------------------------------
-    sf::Font font;
-    if (!font.loadFromFile("../src/assets/fonts/RobotoMono-Regular.ttf"))
+    FontService::getFont();
+    if (!FontService::isLoaded())
     {
         std::cerr << "Warning: Could not load font for hints" << std::endl;
     }
@@ -94,21 +128,14 @@ int main()
     // Création du background de la fenêtre
     //---------------------------------
 
-    sf::Texture backgroundTexture;
-    if (!backgroundTexture.loadFromFile("../src/assets/images/castleBackground.png"))
-    {
-        std::cerr << "Erreur lors du chargement de la texture de fond. Using fallback background." << std::endl;
-        // create a 1x1 white texture as fallback so the game can continue
-        backgroundTexture.create(1, 1);
-        sf::Image img;
-        img.create(1, 1, sf::Color(50, 50, 80));
-        backgroundTexture.update(img);
-    }
+    // Le fond fait partie de l'atlas, comme les autres images du jeu
+    AtlasRegion backgroundRegion = TextureAtlas::getDefault().getRegion("castleBackground.png");
     sf::Sprite backgroundSprite;
-    backgroundSprite.setTexture(backgroundTexture);
+    backgroundSprite.setTexture(*backgroundRegion.texture);
+    backgroundSprite.setTextureRect(backgroundRegion.rect);
 
     sf::Vector2u windowSize = window.getSize();
-    sf::Vector2u textureSize = backgroundTexture.getSize();
+    sf::Vector2u textureSize(static_cast<unsigned>(backgroundRegion.rect.width), static_cast<unsigned>(backgroundRegion.rect.height));
 
     float scaleX = float(windowSize.x) / textureSize.x * 2.f;
     float scaleY = float(windowSize.y) / textureSize.y * 2.f;
@@ -116,26 +143,28 @@ int main()
     backgroundSprite.setScale(scaleX, scaleY);
 
     //---------------------------------
-    // Création des entités via les factories
+    // Partie : joueur (avec ses potions de départ) et premier niveau, générés depuis la graine
     //---------------------------------
-    auto player = CharacterFactory::createPlayer(window.getSize());
-    // Ajout d'exemples de potions dans l'inventaire du joueur
-    if (player) {
-        player->addItem(std::make_unique<HealthPotion>(20));
-        player->addItem(std::make_unique<HealthPotion>(20));
-        player->addItem(std::make_unique<HealthPotion>(50));
-    }
+    GameRandom::seed(seed);
+    GameSession session(window.getSize(), [&backgroundSprite](GameLevel &level)
+                        { buildLevelVisuals(level, backgroundSprite); });
+    Player *player = &session.getPlayer();
+    const GameLevel &currentLevel = session.getLevel();
     auto npcs = CharacterFactory::createNonPlayer(window.getSize(), {2.5f, 2.f});
 
+    // Entrées de chaque tick simulé, écrites à la fermeture ; la simulation avance alors à pas fixe (tickSeconds)
+    std::unique_ptr<InputRecording> recording;
+    if (!recordPath.empty())
+    {
+        recording = std::make_unique<InputRecording>();
+        recording->seed = seed;
+        recording->areaSize = window.getSize();
+    }
+
     //---------------------------------
     // Système de tremblement de caméra
     //---------------------------------
     CameraShake cameraShake;
-    if (player)
-        player->setCameraShake(&cameraShake);
-
-    // Générer le premier niveau
-    GameLevel currentLevel = generateNewLevel(window);
 
     int mismatches = 0;
     const auto &gridRef = currentLevel.mazeGenerator->getGrid();
@@ -309,339 +338,282 @@ int main()
     // Une case fait 256 pixels (64 pixels de sprite * 4x échelle)
     float cameraWidth = 3.f * 256.f; 
     float cameraHeight = cameraWidth * (window.getSize().y / static_cast<float>(window.getSize().x));
+    // Un texel de sprite couvre 4 unités du monde : la vue en compte un nombre entier en hauteur
+    const float worldUnitsPerTexel = 4.f;
+    cameraHeight = std::round(cameraHeight / worldUnitsPerTexel) * worldUnitsPerTexel;
     
     sf::View gameView(sf::Vector2f(0.f, 0.f), sf::Vector2f(cameraWidth, cameraHeight));
     window.setView(gameView);
 
     //---------------------------------
-    // Liste globale des personnages
+    // Liste globale des personnages (joueur puis PNJ du niveau courant, tenue par la partie)
     //---------------------------------
-    std::vector<GameCharacter *> allCharacters;
-    allCharacters.push_back(player.get());
-    for (auto &character : currentLevel.spawnedCharacters)
-        allCharacters.push_back(character.get());
+    const std::vector<GameCharacter *> &allCharacters = session.getCharacters();
+    const EventManager &eventManager = session.getEvents();
 
-    EventManager eventManager(window);
     DevMode dev(true);
+    std::vector<GameCharacter *> visibleCharacters;
     UIManager uiManager;
-    // Register UI manager with event manager
-    eventManager.setUIManager(&uiManager);
-    gUIManager = &uiManager;
     sf::Clock clock;
     
-    int levelCounter = 1;  // Track current level
-    
     PauseMenu pauseMenu;
     bool showPauseMenu = false;
     bool isPaused = false;
+    InputSystem inputSystem;
+
+    //---------------------------------
+    // Abonnés du bus d'événements de jeu (distribués après chaque tick)
+    //---------------------------------
+    GameplayEventBus &gameplayEvents = GameplayEventBus::getInstance();
+    // Caméra : tremblement sur les attaques (après leur délai) et les dégâts du joueur, arrêt au changement de niveau
+    gameplayEvents.subscribe<AttackStarted>([&cameraShake, player](const AttackStarted &event)
+    {
+        if (event.attacker == player)
+            cameraShake.trigger(0.15f, 4.f, 15.f, event.delay); // duration, intensity, frequency, delay
+    });
+    gameplayEvents.subscribe<DamageDealt>([&cameraShake, player](const DamageDealt &event)
+    {
+        if (event.target == player)
+            cameraShake.trigger(0.3f, 8.f, 12.f); // duration, intensity, frequency
+    });
+    gameplayEvents.subscribe<LevelCompleted>([&cameraShake](const LevelCompleted &) { cameraShake.stop(); });
+    // Interface : butin du coffre ouvert
+    gameplayEvents.subscribe<ChestOpened>([&uiManager](const ChestOpened &event)
+    {
+        for (const auto &name : event.rejected)
+            uiManager.addNotification(std::string("Inventaire plein: ") + name, 4.f);
+        if (!event.obtained.empty())
+        {
+            std::string msg = "Vous avez trouvé: ";
+            for (size_t i = 0; i < event.obtained.size(); ++i)
+            {
+                if (i) msg += ", ";
+                msg += event.obtained[i];
+            }
+            uiManager.addNotification(msg, 4.f);
+        }
+    });
+    GameplayTelemetry telemetry;
+    telemetry.subscribe(gameplayEvents);
 
-    // Variables pour la gestion des coffres et portes
-    Chest* currentChestNearby = nullptr;
-    Door* currentDoorNearby = nullptr;
+    bool startupReported = false;
+    bool showProfiler = false;
+
+    //---------------------------------
+    // Thread de rendu : dessine les instantanés publiés par la simulation
+    //---------------------------------
+    RenderThread renderThread(window, backgroundSprite, &dev);
+    // Résolution interne du monde : 2 pixels par texel de sprite, un nombre entier pour que tous les texels
+    // gardent la même largeur quand la caméra défile ; 384x216 en 16:9, agrandie x5 en 1080p, x10 en 4K
+    // (0 = résolution native)
+    const unsigned pixelsPerTexel = 2;
+    renderThread.setInternalHeight(static_cast<unsigned>(cameraHeight / worldUnitsPerTexel) * pixelsPerTexel);
+    renderThread.start();
+    Renderer &renderer = renderThread;
+
+    // La simulation n'attend plus display() : elle est cadencée ici (même cadence que l'affichage)
+    const sf::Time tickTime = sf::seconds(1.f / 60.f);
+    sf::Clock tickClock;
+    bool running = true;
 
     //---------------------------------
     // Boucle principale
     //---------------------------------
-    while (window.isOpen())
+    while (running)
     {
+        tickClock.restart();
         float deltaTime = clock.restart().asSeconds();
         uiManager.updateNotifications(deltaTime);
 
-        sf::Event event;
-        while (window.pollEvent(event))
+        // Seul endroit où la file d'événements de la fenêtre est vidée, juste avant la simulation
+        // (après l'attente de cadence de la frame précédente). Fenêtre sans focus : on bloque sur
+        // les événements au lieu de simuler et dessiner à vide
+        const bool waitForFocus = isPaused;
         {
-            if (event.type == sf::Event::Closed)
-                window.close();
+            PROFILE_SCOPE(Input);
+            inputSystem.pump(window, waitForFocus);
+        }
+        if (inputSystem.isCloseRequested())
+            running = false;
+        isPaused = !inputSystem.hasFocus();
 
-            if (event.type == sf::Event::LostFocus)
-                isPaused = true;
+        // Le temps passé à attendre le focus ne compte pas dans le prochain deltaTime
+        if (waitForFocus)
+            clock.restart();
 
-            if (event.type == sf::Event::GainedFocus)
-                isPaused = false;
-            
-            // Détection d'Échap pour la pause (car les événements sont consommés ici)
-            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)
-            {
-                eventManager.setPaused(!eventManager.isPaused());
-                // std::cout << "[DEBUG MAIN] Échap détecté! paused = " << eventManager.isPaused() << std::endl;
-            }
-                
-            // Gestion du menu de pause
+        if (inputSystem.wasPressed(UiAction::Pause))
+        {
+            showPauseMenu = !showPauseMenu;
             if (showPauseMenu)
-            {
-                if (event.type == sf::Event::KeyPressed)
-                {
-                    if (event.key.code == sf::Keyboard::Up)
-                        pauseMenu.moveSelection(-1);
-                    else if (event.key.code == sf::Keyboard::Down)
-                        pauseMenu.moveSelection(1);
-                    else if (event.key.code == sf::Keyboard::Return)
-                    {
-                        if (pauseMenu.getSelectedOption() == PauseMenu::MenuOption::Continue)
-                        {
-                            showPauseMenu = false;
-                            eventManager.setPaused(false);
-                        }
-                        else if (pauseMenu.getSelectedOption() == PauseMenu::MenuOption::Quit)
-                        {
-                            window.close();
-                        }
-                    }
-                }
-            }
+                pauseMenu.resetSelection();
         }
-
-        // Synchroniser l'état de pause avec EventManager
-        if (eventManager.isPaused() && !eventManager.isInventoryOpen())
+        else if (showPauseMenu)
         {
-            if (!showPauseMenu)
+            if (inputSystem.wasPressed(UiAction::MenuUp))
+                pauseMenu.moveSelection(-1);
+            else if (inputSystem.wasPressed(UiAction::MenuDown))
+                pauseMenu.moveSelection(1);
+            else if (inputSystem.wasPressed(UiAction::MenuConfirm))
             {
-                // std::cout << "[DEBUG MAIN] Mise en pause, affichage du menu" << std::endl;
-                showPauseMenu = true;
-                pauseMenu.resetSelection();
+                // Entrée valide le menu : elle n'atteint pas la partie qui reprend (ni l'enregistrement)
+                inputSystem.consume(UiAction::MenuConfirm);
+                if (pauseMenu.getSelectedOption() == PauseMenu::MenuOption::Continue)
+                    showPauseMenu = false;
+                else if (pauseMenu.getSelectedOption() == PauseMenu::MenuOption::Quit)
+                    running = false;
             }
         }
-        else
-        {
-            if (showPauseMenu)
-                // std::cout << "[DEBUG MAIN] Reprise du jeu, masquage du menu" << std::endl;
-            showPauseMenu = false;
-        }
-
-        // Toujours appeler processEvents pour détecter Échap et les inputs du menu
-        eventManager.processEvents(*player, allCharacters, currentLevel.grounds);
 
-        // Détection des coffres proches du joueur
-        currentChestNearby = nullptr;
-        sf::FloatRect playerBounds = player->getBounds();
-        for (auto &chest : currentLevel.gameObjects)
+        // Profiler : F3 affiche les temps par étape, F9 écrit les dernières frames en CSV,
+        // F10 démarre ou arrête une trace Chrome/Perfetto (trace.json)
+        if (inputSystem.wasPressed(UiAction::ToggleProfiler))
+            showProfiler = !showProfiler;
+        if (inputSystem.wasPressed(UiAction::DumpProfile))
+            FrameProfiler::getInstance().dumpCsv("frame_profile.csv");
+#ifdef GAME_PROFILING
+        if (inputSystem.wasPressed(UiAction::ToggleTrace))
         {
-            if (Chest *c = dynamic_cast<Chest *>(chest.get()))
-            {
-                if (!c->getIsOpened() && c->isPlayerOnChest(playerBounds))
-                {
-                    currentChestNearby = c;
-                    break;
-                }
-            }
+            if (TraceRecorder::isRecording())
+                TraceRecorder::getInstance().stop();
+            else
+                TraceRecorder::getInstance().start("trace.json");
         }
+#endif
 
-        // Ouvrir le coffre si E est pressé
-        if (eventManager.isInteractPressed() && currentChestNearby != nullptr)
+        // Le menu de pause et la perte de focus figent la partie : aucun tick n'est simulé (ni enregistré)
+        if (!isPaused && !showPauseMenu)
         {
-            if (!currentChestNearby->getIsOpened())
-            {
-                currentChestNearby->open();
-                auto loot = currentChestNearby->generateLoot(levelCounter);
-                std::vector<std::string> obtained;
-                for (auto &itemPtr : loot)
-                {
-                    std::string name = itemPtr->getName();
-                    if (player->addItem(std::move(itemPtr)))
-                    {
-                        obtained.push_back(name);
-                    }
-                    else
-                    {
-                        uiManager.addNotification(std::string("Inventaire plein: ") + name, 4.f);
-                    }
-                }
+            const InputState input = inputSystem.getState();
 
-                if (!obtained.empty())
-                {
-                    std::string msg = "Vous avez trouvé: ";
-                    for (size_t i = 0; i < obtained.size(); ++i)
-                    {
-                        if (i) msg += ", ";
-                        msg += obtained[i];
-                    }
-                    uiManager.addNotification(msg, 4.f);
-                }
-            }
+            // Entrée du joueur, coffre et porte à portée, puis comportements, physique et collisions
+            // (pas fixe pendant un enregistrement : le rejeu doit refaire exactement les mêmes calculs)
+            session.tick(input, recording ? recording->tickSeconds : deltaTime);
+            if (recording)
+                recording->append(input);
+
+            // Butin, dégâts, changement de niveau... : interface, caméra et télémétrie
+            gameplayEvents.dispatch();
         }
 
-        // Détection des portes proches du joueur
-        currentDoorNearby = nullptr;
-        for (auto &obj : currentLevel.gameObjects)
+        // L'inventaire met aussi le jeu en pause (EventManager::isPaused)
+        if (!isPaused && !showPauseMenu && !eventManager.isPaused())
         {
-            if (Door *d = dynamic_cast<Door *>(obj.get()))
-            {
-                if (d->isPlayerOnDoor(playerBounds))
-                {
-                    currentDoorNearby = d;
-                    break;
-                }
-            }
+            // Update camera to follow player (la vue carte dessine sa propre texture, voir Minimap)
+            sf::Vector2f playerPos = player->getPosition();
+
+            // Mettre à jour et appliquer le tremblement de caméra
+            sf::Vector2f shakeOffset = cameraShake.update(deltaTime);
+            playerPos += shakeOffset;
+
+            gameView.setCenter(playerPos);
         }
 
-        // Transitionner vers le niveau suivant si E est pressé sur la exitDoor
-        if (eventManager.isInteractPressed() && currentDoorNearby != nullptr && currentDoorNearby->getDoorType() == Door::DoorType::ExitDoor)
+        //---------------------------------
+        // Instantané de rendu du tick (dessiné par le thread de rendu)
+        //---------------------------------
+        RenderSnapshot &frame = renderer.beginSnapshot();
+        frame.level = currentLevel.visuals;
+        frame.mapView = eventManager.isMapViewActive();
+        frame.playerPosition = player->getPosition();
+        frame.explored = currentLevel.explored;
+        // Pause, inventaire ou fenêtre sans focus : le monde ne bouge pas, seule l'interface est
+        // reconstruite (le rendu réaffiche le dernier monde reçu)
+        frame.worldFrozen = isPaused || showPauseMenu || eventManager.isInventoryOpen();
+        if (!frame.worldFrozen)
         {
-            // Générer un nouveau niveau
-            currentLevel = generateNewLevel(window);
-            levelCounter++;  // Increment level counter
-            
-            // Arrêter le tremblement de caméra
-            cameraShake.stop();
-            
-            // Réinitialiser la liste allCharacters avec les nouveaux personnages
-            allCharacters.clear();
-            allCharacters.push_back(player.get());
-            for (auto &character : currentLevel.spawnedCharacters)
-                allCharacters.push_back(character.get());
-            
-            // Repositionner le joueur à la startDoor
-            // La startDoor est à la position (0, 7), ce qui correspond au bas à gauche
-            player->setPosition(20.f, 256.f * 8);
+            frame.view = gameView;
+            frame.sprites.clear();
+            frame.culling.reset();
+            frame.healthBars.clear();
+            frame.showChestHint = false;
+            frame.showDoorHint = false;
         }
 
-        if (!isPaused && !showPauseMenu)
+        if (!frame.mapView && !frame.worldFrozen)
         {
-            // Update
-            for (auto *character : allCharacters)
+            PROFILE_SCOPE(Culling);
+            // Culling : seuls les objets et personnages dans la vue sont soumis (le décor l'est côté rendu)
+            const sf::FloatRect viewRect = VisibilityGrid::getViewRect(gameView);
+            currentLevel.visibilityGrid.submitObjects(frame.sprites, viewRect, frame.culling);
+            VisibilityGrid::collectVisibleCharacters(viewRect, allCharacters, visibleCharacters, frame.culling);
+            for (auto *character : visibleCharacters)
             {
-                if (character->isAlive())
-                {
-                    // Update behavior for non-player characters (enemies)
-                    if (NonPlayer *npc = dynamic_cast<NonPlayer *>(character))
-                    {
-                        npc->updateBehavior(deltaTime, player.get(), currentLevel.grounds);
-                    }
-                    else
-                    {
-                        character->update(deltaTime, currentLevel.grounds);
-                    }
-                }
+                character->submit(frame.sprites);
+                // Barres de vie au-dessus des PNJ visibles
+                if (character != player)
+                    frame.healthBars.push_back({character->getPosition(), character->getBounds().width, character->getHp(), character->getMaxHp()});
             }
 
-            allCharacters.erase(
-                std::remove_if(allCharacters.begin(), allCharacters.end(),
-                               [](GameCharacter *c)
-                               { return !c->isAlive() && dynamic_cast<NonPlayer *>(c); }),
-                allCharacters.end());
-
-            // Character-vs-character collisions: stronger pushes weaker; equal strength -> no movement
-            for (size_t i = 0; i < allCharacters.size(); ++i)
-            {
-                for (size_t j = i + 1; j < allCharacters.size(); ++j)
-                {
-                    GameCharacter *a = allCharacters[i];
-                    GameCharacter *b = allCharacters[j];
-                    if (a->isAlive() && b->isAlive())
-                    {
-                        a->resolveCollisionWithCharacter(*b, currentLevel.grounds);
-                    }
-                }
-            }
-            
-            // Update camera to follow player or show full map
-            if (eventManager.isMapViewActive())
+            // Hint "[E]" si un coffre est proche
+            Chest *currentChestNearby = session.getNearbyChest();
+            if (currentChestNearby != nullptr && !currentChestNearby->getIsOpened())
             {
-                // Vue de la carte complète
-                // Calcul du centre et de la taille pour voir la map entière
-                float mapWidth = 14.f * 274.f;  // 14 cases de 128 pixels
-                float mapHeight = 8.f * 270.f;   // 8 cases de 128 pixels
-                sf::View mapView(sf::Vector2f(mapWidth / 2.f, mapHeight / 2.f), sf::Vector2f(mapWidth, mapHeight));
-                window.setView(mapView);
+                sf::Vector2f chestPos = currentChestNearby->getPosition();
+                frame.showChestHint = true;
+                frame.chestHintPosition = sf::Vector2f(chestPos.x, chestPos.y - 30.f);
             }
-            else
+
+            // Hint "[E]" si une porte de sortie est proche
+            Door *currentDoorNearby = session.getNearbyDoor();
+            if (currentDoorNearby != nullptr && currentDoorNearby->getDoorType() == Door::DoorType::ExitDoor)
             {
-                // Vue du joueur
-                sf::Vector2f playerPos = player->getPosition();
-                
-                // Mettre à jour et appliquer le tremblement de caméra
-                sf::Vector2f shakeOffset = cameraShake.update(deltaTime);
-                playerPos += shakeOffset;
-                
-                gameView.setCenter(playerPos);
-                window.setView(gameView);
+                sf::Vector2f doorPos = currentDoorNearby->getPosition();
+                frame.showDoorHint = true;
+                frame.doorHintPosition = sf::Vector2f(doorPos.x, doorPos.y - 30.f);
             }
         }
 
-        window.clear();
-
-        window.draw(backgroundSprite);
+        frame.hud = {player->getHp(), player->getMaxHp(), player->getMana(), player->getMaxMana(),
+                     player->getEndurance(), player->getMaxEndurance(), session.getLevelCounter()};
+        uiManager.getNotificationTexts(frame.notifications);
 
-        for (auto &g : currentLevel.grounds)
-            g->draw(window);
-
-        // Afficher les objets du jeu (coffres, etc.)
-        for (auto &obj : currentLevel.gameObjects)
-            obj->draw(window);
-
-        // Afficher le hint "[E]" si un coffre est proche
-        if (currentChestNearby != nullptr && !currentChestNearby->getIsOpened())
-        {
-            sf::Text hintText;
-            hintText.setFont(font);
-            hintText.setString("[E]");
-            hintText.setCharacterSize(20);
-            hintText.setFillColor(sf::Color::Yellow);
-            
-            sf::Vector2f chestPos = currentChestNearby->getPosition();
-            hintText.setPosition(chestPos.x, chestPos.y - 30.f);
-            window.draw(hintText);
-        }
-
-        // Afficher le hint "[E]" si une porte est proche
-        if (currentDoorNearby != nullptr && currentDoorNearby->getDoorType() == Door::DoorType::ExitDoor)
+        frame.inventoryOpen = eventManager.isInventoryOpen();
+        if (frame.inventoryOpen)
         {
-            sf::Text hintText;
-            hintText.setFont(font);
-            hintText.setString("[E] Next Level");
-            hintText.setCharacterSize(18);
-            hintText.setFillColor(sf::Color::Cyan);
-            
-            sf::Vector2f doorPos = currentDoorNearby->getPosition();
-            hintText.setPosition(doorPos.x, doorPos.y - 30.f);
-            window.draw(hintText);
+            uiManager.getInventoryMenu().setSelectedSlot(eventManager.getInventorySelection());
+            uiManager.getInventoryMenu().capture(*player, frame.inventory);
         }
 
-            for (auto *character : allCharacters)
-            if (character->isAlive())
-                character->draw(window);
-
-        // Draw health bars above NPCs
-        uiManager.drawHealthBars(window, allCharacters, player.get());
+        frame.pauseMenuVisible = showPauseMenu;
+        frame.pauseSelection = static_cast<int>(pauseMenu.getSelectedOption());
+        frame.showProfiler = showProfiler;
+        frame.hasInputEvent = inputSystem.hasKeyEvent();
+        frame.inputEventTime = inputSystem.getFirstKeyEventTime();
 
-        // Draw player HUD (HP, Mana, Stamina, Level) at bottom-left
-        uiManager.drawPlayerHUD(window, *player, levelCounter);
-        // Draw ephemeral notifications (right side)
-        uiManager.drawNotifications(window);
+        renderer.publish();
 
         // dev.drawInfo(window, *player, allCharacters);
         
         // dev.drawDebugOverlays(window, *player, currentLevel.grounds, allCharacters);
 
-        // Si l'inventaire est ouvert, l'afficher (vue par défaut)
-        if (eventManager.isInventoryOpen())
+        if (!startupReported && renderThread.hasPresentedFrame())
         {
-            sf::View currentView = window.getView();
-            window.setView(window.getDefaultView());
-            uiManager.drawInventoryMenu(window, *player);
-            window.setView(currentView);
+            std::cout << "Startup time: " << startupClock.getElapsedTime().asMilliseconds() << " ms (first frame displayed)\n";
+            startupReported = true;
         }
 
-        // Afficher le menu de pause si actif
-        if (showPauseMenu)
-        {
-            // std::cout << "[DEBUG MAIN] Dessin du menu de pause" << std::endl;
-            
-            // Sauvegarder la vue actuelle (vue du jeu zoomée)
-            sf::View currentView = window.getView();
-            
-            // Appliquer la vue par défaut de la fenêtre pour le menu
-            window.setView(window.getDefaultView());
-            
-            // Dessiner le menu de pause
-            pauseMenu.draw(window);
-            
-            // Restaurer la vue du jeu
-            window.setView(currentView);
-        }
+        sf::Time remaining = tickTime - tickClock.getElapsedTime();
+        if (remaining > sf::Time::Zero)
+            sf::sleep(remaining);
+
+        PROFILE_END_FRAME();
+    }
+
+    renderThread.stop();
+    telemetry.report(std::cout);
 
-        window.display();
+    // L'empreinte de l'état final permet au rejeu de vérifier qu'il refait la même partie
+    if (recording)
+    {
+        recording->finalStateHash = session.computeStateHash();
+        if (recording->save(recordPath))
+            std::cout << "Recorded " << recording->getTickCount() << " ticks to " << recordPath << "\n";
     }
+#ifdef GAME_PROFILING
+    TraceRecorder::getInstance().stop();
+#endif
+    window.setActive(true);
+    window.close();
 
     return 0;
 }
@@ -3,26 +3,18 @@
 #include "../items/ManaPotion.hpp"
 #include "../items/HealthAmulet.hpp"
 #include "../items/DamageAmulet.hpp"
-#include <random>
+#include "../core/GameRandom.hpp"
 #include <functional>
 #include <algorithm>
 
 /**
  * @brief Constructeur de Chest
  */
-Chest::Chest(const sf::Vector2f &position, std::shared_ptr<sf::Texture> texture)
-    : Object("Chest", position, texture), closedTexture(texture)
+Chest::Chest(const sf::Vector2f &position, const AtlasRegion &closed, const AtlasRegion &opened)
+    : Object("Chest", position, closed), closedRegion(closed), openedRegion(opened)
 {
     // Scaling par défaut (4x comme les autres éléments du jeu)
     sprite.setScale(4.f, 4.f);
-    
-    // Charger la texture du coffre ouvert
-    openedTexture = std::make_shared<sf::Texture>();
-    if (!openedTexture->loadFromFile("../src/assets/images/chestOpened.png"))
-    {
-        // Si le fichier n'existe pas, utiliser la même texture
-        openedTexture = closedTexture;
-    }
 }
 
 /**
@@ -36,32 +28,21 @@ std::vector<std::unique_ptr<Item>> Chest::generateLoot(int level) const
     // Prévenir des coffres gigantesques : cap raisonnable
     if (count > 5) count = 5;
 
-    // Moteur aléatoire (seed une fois)
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-
-    // Plages dynamiques basées sur le niveau pour varier les effets
-    std::uniform_int_distribution<int> hpPotRange(10 + level, 20 + level * 2);
-    std::uniform_int_distribution<int> manaPotRange(5 + level / 2, 15 + level);
-    std::uniform_int_distribution<int> healthAmuletRange(5 + level / 5, 15 + level / 2);
-    std::uniform_int_distribution<int> damageAmuletRange(1 + level / 10, 3 + level / 20);
-
-    // Table des loot : pair(poids, factory)
+    // Table des loot : pair(poids, factory), plages dynamiques basées sur le niveau pour varier les effets
+    // (tirages par le générateur de la partie, voir GameRandom)
     std::vector<std::pair<int, std::function<std::unique_ptr<Item>()>>> table;
-    table.push_back({40, [&](){ return std::make_unique<HealthPotion>(hpPotRange(gen)); }});
-    table.push_back({25, [&](){ return std::make_unique<ManaPotion>(manaPotRange(gen)); }});
-    table.push_back({15, [&](){ return std::make_unique<HealthAmulet>(healthAmuletRange(gen)); }});
-    table.push_back({20, [&](){ return std::make_unique<DamageAmulet>(damageAmuletRange(gen)); }});
+    table.push_back({40, [&](){ return std::make_unique<HealthPotion>(GameRandom::range(10 + level, 20 + level * 2)); }});
+    table.push_back({25, [&](){ return std::make_unique<ManaPotion>(GameRandom::range(5 + level / 2, 15 + level)); }});
+    table.push_back({15, [&](){ return std::make_unique<HealthAmulet>(GameRandom::range(5 + level / 5, 15 + level / 2)); }});
+    table.push_back({20, [&](){ return std::make_unique<DamageAmulet>(GameRandom::range(1 + level / 10, 3 + level / 20)); }});
 
     int totalWeight = 0;
     for (auto &p : table) totalWeight += p.first;
 
-    std::uniform_int_distribution<int> pickDist(1, totalWeight);
-
     std::vector<std::unique_ptr<Item>> loot;
     for (int i = 0; i < count; ++i)
     {
-        int r = pickDist(gen);
+        int r = GameRandom::range(1, totalWeight);
         int accum = 0;
         for (auto &p : table)
         {
@@ -103,15 +84,10 @@ void Chest::open()
  */
 void Chest::setTexture(bool opened)
 {
-    if (opened)
-    {
-        this->texture = openedTexture;
-    }
-    else
-    {
-        this->texture = closedTexture;
-    }
+    const AtlasRegion &region = opened ? openedRegion : closedRegion;
+    this->texture = region.texture;
     this->sprite.setTexture(*this->texture);
+    this->sprite.setTextureRect(region.rect);
 }
 
 /**
@@ -13,16 +13,17 @@ class Chest : public Object
 {
 private:
     bool isOpened = false;  // État du coffre
-    std::shared_ptr<sf::Texture> closedTexture;
-    std::shared_ptr<sf::Texture> openedTexture;
+    AtlasRegion closedRegion;
+    AtlasRegion openedRegion;
 
 public:
     /**
      * @brief Constructeur de Chest
      * @param position Position du coffre dans le monde
-     * @param texture Texture du coffre
+     * @param closed Région de l'atlas du coffre fermé
+     * @param opened Région de l'atlas du coffre ouvert
      */
-    Chest(const sf::Vector2f &position, std::shared_ptr<sf::Texture> texture);
+    Chest(const sf::Vector2f &position, const AtlasRegion &closed, const AtlasRegion &opened);
 
     /**
      * @brief Vérifie si le coffre est ouvert
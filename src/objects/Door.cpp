@@ -3,8 +3,8 @@
 /**
  * @brief Constructeur de Door
  */
-Door::Door(const sf::Vector2f &position, std::shared_ptr<sf::Texture> texture, DoorType type)
-    : Object("Door", position, texture), doorType(type)
+Door::Door(const sf::Vector2f &position, const AtlasRegion &region, DoorType type)
+    : Object("Door", position, region), doorType(type)
 {
     // Scaling pour les portes (plus petit que les autres objets)
     sprite.setScale(2.f, 2.f);
@@ -21,10 +21,10 @@ public:
     /**
      * @brief Constructeur de Door
      * @param position Position de la porte dans le monde
-     * @param texture Texture de la porte
+     * @param region Région de l'atlas de la porte
      * @param type Type de porte
      */
-    Door(const sf::Vector2f &position, std::shared_ptr<sf::Texture> texture, DoorType type);
+    Door(const sf::Vector2f &position, const AtlasRegion &region, DoorType type);
 
     /**
      * @brief Retourne le type de porte
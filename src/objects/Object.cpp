@@ -1,12 +1,14 @@
 #include "Object.hpp"
+#include "../rendering/SpriteBatch.hpp"
 
 /**
  * @brief Constructeur de Object
  */
-Object::Object(const std::string &name, const sf::Vector2f &position, std::shared_ptr<sf::Texture> texture)
-    : name(name), position(position), texture(std::move(texture))
+Object::Object(const std::string &name, const sf::Vector2f &position, const AtlasRegion &region)
+    : name(name), position(position), texture(region.texture)
 {
     sprite.setTexture(*this->texture);
+    sprite.setTextureRect(region.rect);
     sprite.setPosition(position);
     // Scaling spécifié dans les classes héritantes
     hitbox = sf::FloatRect(position.x, position.y, 32.f * 4.f, 32.f * 4.f);
@@ -15,9 +17,17 @@ Object::Object(const std::string &name, const sf::Vector2f &position, std::share
 /**
  * @brief Affiche l'objet
  */
-void Object::draw(sf::RenderWindow &window)
+void Object::draw(sf::RenderTarget &target)
 {
-    window.draw(sprite);
+    target.draw(sprite);
+}
+
+/**
+ * @brief Ajoute l'objet au lot de sprites de la frame
+ */
+void Object::submit(SpriteBatch &batch) const
+{
+    batch.submit(sprite, sprite.getTransform(), SpriteBatch::Objects);
 }
 
 /**
@@ -28,6 +38,14 @@ sf::FloatRect Object::getBounds() const
     return hitbox;
 }
 
+/**
+ * @brief Retourne la zone occupée à l'écran par le sprite
+ */
+sf::FloatRect Object::getVisualBounds() const
+{
+    return sprite.getGlobalBounds();
+}
+
 /**
  * @brief Retourne la position de l'objet
  */
@@ -2,6 +2,9 @@
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <string>
+#include "../resources/TextureAtlas.hpp"
+
+class SpriteBatch;
 
 /**
  * @brief Classe de base pour tous les objets du jeu (coffres, pièges, etc.)
@@ -20,22 +23,32 @@ public:
      * @brief Constructeur de Object
      * @param name Nom de l'objet
      * @param position Position de l'objet dans le monde
-     * @param texture Texture de l'objet
+     * @param region Région de l'atlas utilisée comme image de l'objet
      */
-    Object(const std::string &name, const sf::Vector2f &position, std::shared_ptr<sf::Texture> texture);
+    Object(const std::string &name, const sf::Vector2f &position, const AtlasRegion &region);
     
     virtual ~Object() = default;
 
     /**
      * @brief Affiche l'objet
      */
-    virtual void draw(sf::RenderWindow &window);
+    virtual void draw(sf::RenderTarget &target);
+
+    /**
+     * @brief Ajoute l'objet au lot de sprites de la frame
+     */
+    void submit(SpriteBatch &batch) const;
 
     /**
      * @brief Retourne les limites de l'objet
      */
     virtual sf::FloatRect getBounds() const;
 
+    /**
+     * @brief Retourne la zone occupée à l'écran par le sprite (utilisée pour le culling)
+     */
+    sf::FloatRect getVisualBounds() const;
+
     /**
      * @brief Retourne la position de l'objet
      */
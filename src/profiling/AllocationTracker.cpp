@@ -0,0 +1,112 @@
+#include "AllocationTracker.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    // Initialisés avant toute allocation (initialisation constante) : utilisables depuis operator new
+    std::atomic<std::uint64_t> allocationCounts[AllocationTracker::maxTags];
+    std::atomic<std::uint64_t> allocatedBytes[AllocationTracker::maxTags];
+    thread_local std::uint8_t currentTag = AllocationTracker::untagged;
+}
+
+bool AllocationTracker::isEnabled()
+{
+#ifdef GAME_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::uint8_t AllocationTracker::setTag(std::uint8_t tag)
+{
+    std::uint8_t previous = currentTag;
+    currentTag = tag < maxTags ? tag : untagged;
+    return previous;
+}
+
+AllocationTracker::Counts AllocationTracker::getCounts(std::uint8_t tag)
+{
+    if (tag >= maxTags)
+        return {};
+    return {allocationCounts[tag].load(std::memory_order_relaxed), allocatedBytes[tag].load(std::memory_order_relaxed)};
+}
+
+AllocationTracker::Counts AllocationTracker::getTotal()
+{
+    Counts total;
+    for (std::uint8_t tag = 0; tag < maxTags; ++tag)
+    {
+        Counts counts = getCounts(tag);
+        total.allocations += counts.allocations;
+        total.bytes += counts.bytes;
+    }
+    return total;
+}
+
+void AllocationTracker::record(std::size_t bytes)
+{
+    allocationCounts[currentTag].fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes[currentTag].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+#ifdef GAME_PROFILING
+
+// Remplacement des allocations globales : comptage puis malloc/free
+void *operator new(std::size_t size)
+{
+    AllocationTracker::record(size);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    AllocationTracker::record(size);
+    return std::malloc(size ? size : 1);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+    return ::operator new(size, tag);
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept
+{
+    std::free(p);
+}
+
+#endif
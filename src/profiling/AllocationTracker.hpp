@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Compteurs d'allocations du tas, ventilés par étiquette.
+ *
+ * L'étiquette est propre à chaque thread : FrameProfiler::Scope y place l'étape mesurée, les
+ * allocations faites hors de toute étape sont comptées sous untagged.
+ *
+ * Avec GAME_PROFILING, les operator new globaux sont remplacés (AllocationTracker.cpp) ;
+ * sans lui, les compteurs restent à zéro et isEnabled() rend false.
+ */
+class AllocationTracker
+{
+public:
+    static constexpr std::uint8_t maxTags = 16;
+    static constexpr std::uint8_t untagged = maxTags - 1;
+
+    struct Counts
+    {
+        std::uint64_t allocations = 0;
+        std::uint64_t bytes = 0;
+    };
+
+    static bool isEnabled();
+
+    /**
+     * @brief Étiquette les prochaines allocations du thread appelant
+     * @return L'étiquette précédente (à restaurer en fin de portée)
+     */
+    static std::uint8_t setTag(std::uint8_t tag);
+
+    // Compteurs cumulés depuis le lancement
+    static Counts getCounts(std::uint8_t tag);
+    static Counts getTotal();
+
+    // Appelé par les operator new remplacés
+    static void record(std::size_t bytes);
+};
@@ -0,0 +1,95 @@
+#include "FrameProfiler.hpp"
+#include <fstream>
+#include <iostream>
+
+thread_local FrameProfiler::Scope *FrameProfiler::Scope::current = nullptr;
+
+FrameProfiler &FrameProfiler::getInstance()
+{
+    static FrameProfiler instance;
+    return instance;
+}
+
+const char *FrameProfiler::getStageName(Stage stage)
+{
+    switch (stage)
+    {
+    case Input: return "input";
+    case AI: return "ai";
+    case Physics: return "physics";
+    case Collisions: return "collisions";
+    case LevelGeneration: return "level_generation";
+    case Culling: return "culling";
+    case RenderSubmit: return "render_submit";
+    case Display: return "display";
+    default: return "unknown";
+    }
+}
+
+void FrameProfiler::endFrame()
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    Frame frame;
+    frame.frameMs = std::chrono::duration<float, std::milli>(now - lastFrame).count();
+    lastFrame = now;
+    for (std::size_t i = 0; i < StageCount; ++i)
+        frame.stageMs[i] = static_cast<float>(pending[i].exchange(0, std::memory_order_relaxed)) / 1.0e6f;
+
+    for (std::size_t i = 0; i <= StageCount; ++i)
+    {
+        const std::uint8_t tag = i < StageCount ? static_cast<std::uint8_t>(i) : AllocationTracker::untagged;
+        const std::uint64_t total = AllocationTracker::getCounts(tag).allocations;
+        frame.allocations[i] = static_cast<std::uint32_t>(total - lastAllocationCounts[i]);
+        lastAllocationCounts[i] = total;
+    }
+
+    std::lock_guard<std::mutex> lock(ringMutex);
+    ring[head] = frame;
+    head = (head + 1) % capacity;
+    if (count < capacity)
+        ++count;
+}
+
+std::size_t FrameProfiler::copyRecent(std::vector<Frame> &frames, std::size_t maxFrames) const
+{
+    std::lock_guard<std::mutex> lock(ringMutex);
+    const std::size_t n = std::min(maxFrames, count);
+    frames.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+        frames[i] = ring[(head + capacity - n + i) % capacity];
+    return n;
+}
+
+bool FrameProfiler::dumpCsv(const std::string &path, std::size_t maxFrames) const
+{
+    std::vector<Frame> frames;
+    copyRecent(frames, maxFrames);
+
+    std::ofstream out(path);
+    if (!out)
+    {
+        std::cerr << "FrameProfiler: impossible d'écrire " << path << "\n";
+        return false;
+    }
+
+    out << "frame,frame_ms";
+    for (std::size_t s = 0; s < StageCount; ++s)
+        out << ',' << getStageName(static_cast<Stage>(s)) << "_ms";
+    for (std::size_t s = 0; s < StageCount; ++s)
+        out << ',' << getStageName(static_cast<Stage>(s)) << "_allocs";
+    out << ",other_allocs\n";
+
+    for (std::size_t i = 0; i < frames.size(); ++i)
+    {
+        out << i << ',' << frames[i].frameMs;
+        for (float ms : frames[i].stageMs)
+            out << ',' << ms;
+        for (std::uint32_t count : frames[i].allocations)
+            out << ',' << count;
+        out << '\n';
+    }
+
+    std::cout << "FrameProfiler: " << frames.size() << " frames écrites dans " << path << "\n";
+    return true;
+}
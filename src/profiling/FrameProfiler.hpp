@@ -0,0 +1,148 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "AllocationTracker.hpp"
+#include "TraceRecorder.hpp"
+
+/**
+ * @brief Chronomètres par étape de la boucle de jeu, enregistrés frame par frame dans un anneau.
+ *
+ * Les étapes sont mesurées par des PROFILE_SCOPE(étape) ; le temps est exclusif (une portée
+ * imbriquée, par exemple la physique dans l'IA, n'est comptée que dans la sienne). Les temps du
+ * thread de rendu sont cumulés jusqu'à la fin du tick de simulation suivant (endFrame()).
+ *
+ * Chaque portée étiquette aussi les allocations du tas faites pendant l'étape (AllocationTracker)
+ * et, pendant un enregistrement (TraceRecorder), produit un événement début/fin au nom de l'étape.
+ *
+ * Sans GAME_PROFILING (option CMake GAME_ENABLE_PROFILER), PROFILE_SCOPE ne génère aucun code.
+ */
+class FrameProfiler
+{
+public:
+    enum Stage : std::uint8_t
+    {
+        Input,
+        AI,
+        Physics,
+        Collisions,
+        LevelGeneration,
+        Culling,
+        RenderSubmit,
+        Display,
+        StageCount
+    };
+
+    struct Frame
+    {
+        float frameMs = 0.f; // durée du tick (attente de cadence comprise)
+        std::array<float, StageCount> stageMs{};
+        // Allocations du tas par étape ; la dernière case compte celles faites hors de toute étape
+        std::array<std::uint32_t, StageCount + 1> allocations{};
+    };
+
+    static_assert(StageCount < AllocationTracker::maxTags, "une étiquette d'allocation par étape");
+
+    static constexpr std::size_t capacity = 600; // 10 s à 60 ticks/s
+
+    static FrameProfiler &getInstance();
+    static const char *getStageName(Stage stage);
+
+    void setEnabled(bool enabled) { this->enabled.store(enabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    // Ajoute un temps (nanosecondes) à l'étape de la frame en cours (tout thread)
+    void addTime(Stage stage, std::int64_t nanoseconds) { pending[stage].fetch_add(nanoseconds, std::memory_order_relaxed); }
+
+    /**
+     * @brief Clôt la frame : les temps cumulés sont rangés dans l'anneau (thread de simulation)
+     */
+    void endFrame();
+
+    /**
+     * @brief Copie les dernières frames, de la plus ancienne à la plus récente
+     * @return Le nombre de frames copiées
+     */
+    std::size_t copyRecent(std::vector<Frame> &frames, std::size_t maxFrames) const;
+
+    /**
+     * @brief Écrit les dernières frames dans un fichier CSV (une ligne par frame, une colonne par étape)
+     * @return true si le fichier a été écrit
+     */
+    bool dumpCsv(const std::string &path, std::size_t maxFrames = capacity) const;
+
+    /**
+     * @brief Chronomètre d'une portée ; utiliser PROFILE_SCOPE plutôt que cette classe directement
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(Stage stage)
+            : stage(stage), active(getInstance().isEnabled()), traced(TraceRecorder::isRecording() && TraceRecorder::getInstance().begin(getStageName(stage))),
+              parent(current)
+        {
+            if (!active)
+                return;
+            current = this;
+            previousTag = AllocationTracker::setTag(stage);
+            start = std::chrono::steady_clock::now();
+        }
+
+        ~Scope()
+        {
+            if (traced)
+                TraceRecorder::getInstance().end(getStageName(stage));
+            if (!active)
+                return;
+            std::int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            getInstance().addTime(stage, elapsed - childNanoseconds);
+            if (parent)
+                parent->childNanoseconds += elapsed;
+            current = parent;
+            AllocationTracker::setTag(previousTag);
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        Stage stage;
+        bool active;
+        bool traced;
+        Scope *parent;
+        std::int64_t childNanoseconds = 0;
+        std::uint8_t previousTag = AllocationTracker::untagged;
+        std::chrono::steady_clock::time_point start;
+
+        static thread_local Scope *current;
+    };
+
+private:
+    FrameProfiler() = default;
+
+    std::atomic<bool> enabled{true};
+    std::array<std::atomic<std::int64_t>, StageCount> pending{};
+    std::chrono::steady_clock::time_point lastFrame = std::chrono::steady_clock::now();
+    std::array<std::uint64_t, StageCount + 1> lastAllocationCounts{}; // cumul lu à la frame précédente
+
+    mutable std::mutex ringMutex;
+    std::array<Frame, capacity> ring{};
+    std::size_t head = 0;  // prochaine case écrite
+    std::size_t count = 0; // frames valides dans l'anneau
+};
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef GAME_PROFILING
+#define PROFILE_SCOPE(stage) FrameProfiler::Scope PROFILE_CONCAT(profileScope, __LINE__)(FrameProfiler::stage)
+#define PROFILE_END_FRAME() FrameProfiler::getInstance().endFrame()
+#else
+#define PROFILE_SCOPE(stage) ((void)0)
+#define PROFILE_END_FRAME() ((void)0)
+#endif
@@ -0,0 +1,203 @@
+#include "TraceRecorder.hpp"
+#include <cstdio>
+#include <iostream>
+
+std::atomic<bool> TraceRecorder::recording{false};
+
+namespace
+{
+    // Anneau du thread courant, créé à son premier événement (ou à setThreadName)
+    thread_local void *localRing = nullptr;
+
+    // Intervalle d'écriture : court devant le temps de remplissage d'un anneau à plein régime
+    constexpr auto writerPeriod = std::chrono::milliseconds(5);
+
+    std::int64_t nowNanoseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+TraceRecorder &TraceRecorder::getInstance()
+{
+    static TraceRecorder instance;
+    return instance;
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    stop();
+}
+
+TraceRecorder::ThreadBuffer &TraceRecorder::localBuffer()
+{
+    if (localRing)
+        return *static_cast<ThreadBuffer *>(localRing);
+
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    buffers.push_back(std::make_unique<ThreadBuffer>());
+    ThreadBuffer &buffer = *buffers.back();
+    buffer.threadId = static_cast<std::uint32_t>(buffers.size());
+    localRing = &buffer;
+    return buffer;
+}
+
+void TraceRecorder::setThreadName(const char *name)
+{
+    getInstance().localBuffer().threadName.store(name, std::memory_order_release);
+}
+
+bool TraceRecorder::start(const std::string &path)
+{
+    std::lock_guard<std::mutex> control(controlMutex);
+    if (recording.load())
+        return false;
+
+    file.open(path, std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::cerr << "TraceRecorder: impossible d'écrire " << path << "\n";
+        return false;
+    }
+    file << "{\"traceEvents\":[\n";
+    firstEvent = true;
+
+    {
+        // Les événements restés d'une trace précédente sont abandonnés
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto &buffer : buffers)
+        {
+            buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+            buffer->nameWritten = false;
+        }
+    }
+
+    origin.store(nowNanoseconds(), std::memory_order_relaxed);
+    stopWriter.store(false);
+    writer = std::thread(&TraceRecorder::writerLoop, this);
+    recording.store(true, std::memory_order_release);
+    std::cout << "TraceRecorder: enregistrement vers " << path << "\n";
+    return true;
+}
+
+void TraceRecorder::stop()
+{
+    std::lock_guard<std::mutex> control(controlMutex);
+    if (!recording.exchange(false))
+        return;
+
+    stopWriter.store(true);
+    if (writer.joinable())
+        writer.join();
+    drain();
+
+    std::uint64_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (const auto &buffer : buffers)
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+
+    file << "\n]}\n";
+    file.close();
+    std::cout << "TraceRecorder: trace terminée";
+    if (dropped > 0)
+        std::cout << " (" << dropped << " événements perdus, anneaux pleins)";
+    std::cout << "\n";
+}
+
+bool TraceRecorder::push(const char *name, char phase, std::int64_t value)
+{
+    const std::int64_t timestamp = nowNanoseconds() - origin.load(std::memory_order_relaxed);
+
+    ThreadBuffer &buffer = localBuffer();
+    const std::size_t head = buffer.head.load(std::memory_order_relaxed);
+    if (head - buffer.tail.load(std::memory_order_acquire) >= ThreadBuffer::capacity)
+    {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    buffer.events[head % ThreadBuffer::capacity] = Event{name, phase, timestamp, value};
+    buffer.head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool TraceRecorder::begin(const char *name)
+{
+    return push(name, 'B', 0);
+}
+
+void TraceRecorder::end(const char *name)
+{
+    push(name, 'E', 0);
+}
+
+void TraceRecorder::counter(const char *name, std::int64_t value)
+{
+    push(name, 'C', value);
+}
+
+void TraceRecorder::instant(const char *name)
+{
+    push(name, 'i', 0);
+}
+
+void TraceRecorder::writerLoop()
+{
+    while (!stopWriter.load())
+    {
+        std::this_thread::sleep_for(writerPeriod);
+        drain();
+    }
+}
+
+/**
+ * @brief Vide les anneaux de tous les threads dans le fichier (thread d'écriture, puis stop())
+ */
+void TraceRecorder::drain()
+{
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (auto &buffer : buffers)
+    {
+        const char *threadName = buffer->threadName.load(std::memory_order_acquire);
+        if (threadName && !buffer->nameWritten)
+        {
+            file << (firstEvent ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+                 << ",\"args\":{\"name\":\"" << threadName << "\"}}";
+            firstEvent = false;
+            buffer->nameWritten = true;
+        }
+
+        const std::size_t tail = buffer->tail.load(std::memory_order_relaxed);
+        const std::size_t head = buffer->head.load(std::memory_order_acquire);
+        for (std::size_t i = tail; i != head; ++i)
+            writeEvent(*buffer, buffer->events[i % ThreadBuffer::capacity]);
+        buffer->tail.store(head, std::memory_order_release);
+    }
+    file.flush();
+}
+
+void TraceRecorder::writeEvent(const ThreadBuffer &buffer, const Event &event)
+{
+    // Horodatage en microsecondes (unité du format), précision à la nanoseconde
+    char line[256];
+    const long long micros = event.timestamp / 1000;
+    const int nanos = static_cast<int>(event.timestamp % 1000);
+    int length = std::snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%lld.%03d,\"pid\":1,\"tid\":%u",
+                               firstEvent ? "" : ",\n", event.name, event.phase, micros, nanos, buffer.threadId);
+    if (length < 0 || length >= static_cast<int>(sizeof(line)))
+        return;
+
+    if (event.phase == 'C')
+        length += std::snprintf(line + length, sizeof(line) - length, ",\"args\":{\"value\":%lld}}", static_cast<long long>(event.value));
+    else if (event.phase == 'i')
+        length += std::snprintf(line + length, sizeof(line) - length, ",\"s\":\"g\"}");
+    else
+        length += std::snprintf(line + length, sizeof(line) - length, "}");
+
+    if (length >= static_cast<int>(sizeof(line)))
+        return;
+    file.write(line, length);
+    firstEvent = false;
+}
@@ -0,0 +1,146 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Enregistre une trace au format Chrome trace-event (JSON), lisible dans Perfetto ou chrome://tracing.
+ *
+ * Chaque thread écrit ses événements (début/fin de portée, compteurs, marqueurs) dans son propre
+ * anneau sans verrou ; un thread de fond les vide régulièrement dans le fichier. Un anneau plein
+ * perd les nouveaux événements (compte rendu à stop()) plutôt que de bloquer le jeu.
+ *
+ * Les noms sont stockés par pointeur : ils doivent vivre jusqu'à la fin de la trace
+ * (littéraux, FrameProfiler::getStageName).
+ */
+class TraceRecorder
+{
+public:
+    static TraceRecorder &getInstance();
+
+    // Vérification rapide, à faire avant tout enregistrement
+    static bool isRecording() { return recording.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Ouvre le fichier et démarre le thread d'écriture
+     * @return false si le fichier ne peut pas être écrit (ou si une trace est déjà en cours)
+     */
+    bool start(const std::string &path);
+
+    /**
+     * @brief Arrête l'enregistrement, écrit les derniers événements et ferme le fichier
+     */
+    void stop();
+
+    // Nom du thread appelant dans la trace ("main", "render", ...)
+    static void setThreadName(const char *name);
+
+    // false si l'événement est perdu (anneau plein) : la fin correspondante ne doit pas être écrite
+    bool begin(const char *name);
+    void end(const char *name);
+    void counter(const char *name, std::int64_t value);
+    void instant(const char *name);
+
+    /**
+     * @brief Portée tracée ; utiliser TRACE_SCOPE plutôt que cette classe directement
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(const char *name) : name(name), traced(isRecording() && getInstance().begin(name))
+        {
+        }
+        ~Scope()
+        {
+            if (traced)
+                getInstance().end(name);
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        const char *name;
+        bool traced;
+    };
+
+private:
+    TraceRecorder() = default;
+    ~TraceRecorder();
+
+    struct Event
+    {
+        const char *name;
+        char phase; // 'B', 'E', 'C' (compteur), 'i' (marqueur)
+        std::int64_t timestamp; // nanosecondes depuis le début de la trace
+        std::int64_t value;
+    };
+
+    /**
+     * @brief Anneau d'un thread : un seul producteur (ce thread), un seul consommateur (l'écriture)
+     */
+    struct ThreadBuffer
+    {
+        static constexpr std::size_t capacity = 16384;
+
+        std::uint32_t threadId = 0;
+        std::atomic<const char *> threadName{nullptr};
+        bool nameWritten = false; // à l'usage du thread d'écriture
+        std::array<Event, capacity> events;
+        std::atomic<std::size_t> head{0}; // prochaine écriture (producteur)
+        std::atomic<std::size_t> tail{0}; // prochaine lecture (consommateur)
+        std::atomic<std::uint64_t> dropped{0};
+    };
+
+    static std::atomic<bool> recording;
+
+    std::mutex buffersMutex; // enregistrement des threads et parcours par l'écriture
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    std::mutex controlMutex; // start/stop
+    std::ofstream file;
+    bool firstEvent = true;
+    std::thread writer;
+    std::atomic<bool> stopWriter{false};
+    std::atomic<std::int64_t> origin{0}; // début de la trace, en nanosecondes de steady_clock
+
+    ThreadBuffer &localBuffer();
+    bool push(const char *name, char phase, std::int64_t value);
+    void writerLoop();
+    void drain();
+    void writeEvent(const ThreadBuffer &buffer, const Event &event);
+};
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#ifdef GAME_PROFILING
+#define TRACE_SCOPE(name) TraceRecorder::Scope TRACE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_COUNTER(name, value)                                              \
+    do                                                                          \
+    {                                                                           \
+        if (TraceRecorder::isRecording())                                       \
+            TraceRecorder::getInstance().counter(name, static_cast<std::int64_t>(value)); \
+    } while (0)
+#define TRACE_INSTANT(name)                          \
+    do                                               \
+    {                                                \
+        if (TraceRecorder::isRecording())            \
+            TraceRecorder::getInstance().instant(name); \
+    } while (0)
+#define TRACE_THREAD_NAME(name) TraceRecorder::setThreadName(name)
+#else
+#define TRACE_SCOPE(name) ((void)0)
+// sizeof : la valeur n'est pas évaluée, mais une variable qui ne sert qu'au compteur reste utilisée
+#define TRACE_COUNTER(name, value) ((void)sizeof(value))
+#define TRACE_INSTANT(name) ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#endif
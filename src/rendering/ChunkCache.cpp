@@ -0,0 +1,155 @@
+#include "ChunkCache.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+/**
+ * @brief Découpe le monde en tuiles ; aucune texture n'est créée avant le premier draw().
+ */
+bool ChunkCache::build(const sf::Vector2f &worldSize, DrawStatic drawStatic)
+{
+    clear();
+
+    columns = static_cast<int>(std::ceil(worldSize.x / chunkSize));
+    rows = static_cast<int>(std::ceil(worldSize.y / chunkSize));
+    if (columns <= 0 || rows <= 0)
+    {
+        columns = rows = 0;
+        return false;
+    }
+
+    this->drawStatic = std::move(drawStatic);
+    slotOfChunk.assign(static_cast<size_t>(columns * rows), -1);
+    pool.reserve(poolCapacity);
+    return true;
+}
+
+void ChunkCache::clear()
+{
+    pool.clear();
+    slotOfChunk.clear();
+    drawStatic = nullptr;
+    frame = 0;
+    columns = rows = 0;
+    failed = false;
+}
+
+void ChunkCache::render(Slot &slot, int chunk)
+{
+    const sf::Vector2f position(static_cast<float>((chunk % columns) * chunkSize), static_cast<float>((chunk / columns) * chunkSize));
+    slot.texture->setView(sf::View(sf::FloatRect(position.x, position.y, static_cast<float>(chunkSize), static_cast<float>(chunkSize))));
+    slot.texture->clear(sf::Color::Transparent);
+    drawStatic(*slot.texture);
+    slot.texture->display();
+}
+
+int ChunkCache::acquire(int chunk)
+{
+    int index = slotOfChunk[static_cast<size_t>(chunk)];
+    if (index >= 0)
+        return index;
+
+    // Case libre tant que le pool n'est pas plein, sinon une tuile recyclée.
+    // Si toutes ont servi à cette frame (vue plus grande que le pool), le pool grandit.
+    if (pool.size() >= poolCapacity)
+        index = findVictim(false);
+    if (index < 0)
+    {
+        Slot slot;
+        slot.texture = std::make_unique<sf::RenderTexture>();
+        if (!slot.texture->create(chunkSize, chunkSize))
+        {
+            std::cerr << "ChunkCache: impossible de créer une RenderTexture, décor dessiné sans cache\n";
+            failed = true;
+            return -1;
+        }
+        pool.push_back(std::move(slot));
+        index = static_cast<int>(pool.size() - 1);
+    }
+
+    Slot &slot = pool[static_cast<size_t>(index)];
+    if (slot.chunk >= 0)
+        slotOfChunk[static_cast<size_t>(slot.chunk)] = -1;
+    slot.chunk = chunk;
+    slotOfChunk[static_cast<size_t>(chunk)] = index;
+    render(slot, chunk);
+    return index;
+}
+
+bool ChunkCache::isKept(int chunk) const
+{
+    const int col = chunk % columns;
+    const int row = chunk / columns;
+    return col >= keep.left && col < keep.left + keep.width && row >= keep.top && row < keep.top + keep.height;
+}
+
+int ChunkCache::findVictim(bool outsideKeepOnly) const
+{
+    int outside = -1;
+    int any = -1;
+    for (size_t i = 0; i < pool.size(); ++i)
+    {
+        const Slot &slot = pool[i];
+        if (slot.lastUsed == frame)
+            continue;
+        if (slot.chunk < 0)
+            return static_cast<int>(i);
+        if (any < 0 || slot.lastUsed < pool[static_cast<size_t>(any)].lastUsed)
+            any = static_cast<int>(i);
+        if (!isKept(slot.chunk) && (outside < 0 || slot.lastUsed < pool[static_cast<size_t>(outside)].lastUsed))
+            outside = static_cast<int>(i);
+    }
+    return (outside >= 0 || outsideKeepOnly) ? outside : any;
+}
+
+void ChunkCache::draw(sf::RenderTarget &target, CullingStats &stats)
+{
+    if (!isBuilt())
+        return;
+    ++frame;
+
+    const sf::FloatRect viewRect = VisibilityGrid::getViewRect(target.getView());
+    const float size = static_cast<float>(chunkSize);
+    int left = std::max(0, static_cast<int>(std::floor(viewRect.left / size)));
+    int top = std::max(0, static_cast<int>(std::floor(viewRect.top / size)));
+    int right = std::min(columns - 1, static_cast<int>(std::floor((viewRect.left + viewRect.width) / size)));
+    int bottom = std::min(rows - 1, static_cast<int>(std::floor((viewRect.top + viewRect.height) / size)));
+    keep = sf::IntRect(left - 1, top - 1, right - left + 3, bottom - top + 3);
+
+    unsigned drawn = 0;
+    sf::Sprite quad;
+    for (int row = top; row <= bottom; ++row)
+    {
+        for (int col = left; col <= right; ++col)
+        {
+            const int index = acquire(row * columns + col);
+            if (index < 0)
+                return;
+            Slot &slot = pool[static_cast<size_t>(index)];
+            slot.lastUsed = frame;
+            quad.setTexture(slot.texture->getTexture(), true);
+            quad.setPosition(static_cast<float>(col * chunkSize), static_cast<float>(row * chunkSize));
+            target.draw(quad);
+            ++drawn;
+        }
+    }
+    stats.drawn += drawn;
+    stats.culled += static_cast<unsigned>(columns * rows) - drawn;
+
+    // Préparer une tuile de la couronne autour de la vue, seulement avec une case libre ou prise
+    // hors de la couronne (jamais en chassant une tuile visible ou déjà préparée)
+    if (pool.size() >= poolCapacity && findVictim(true) < 0)
+        return;
+    for (int row = std::max(0, top - 1); row <= std::min(rows - 1, bottom + 1); ++row)
+    {
+        for (int col = std::max(0, left - 1); col <= std::min(columns - 1, right + 1); ++col)
+        {
+            const int chunk = row * columns + col;
+            if (slotOfChunk[static_cast<size_t>(chunk)] < 0)
+            {
+                acquire(chunk);
+                return;
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "../environnement/VisibilityGrid.hpp"
+
+/**
+ * @brief Cache du décor statique (fond, murs, échelles) rendu dans des sf::RenderTexture.
+ *
+ * Le monde est découpé en tuiles carrées de chunkSize unités, alignées sur des coordonnées
+ * entières pour que chaque texel du cache corresponde exactement à une unité du monde
+ * (même résolution que l'atlas, quelle que soit la taille de la fenêtre). Chaque frame ne compose
+ * que les tuiles qui recouvrent la vue : un quad texturé par tuile visible, quel que soit le nombre de sols.
+ *
+ * Les tuiles sont rendues à la demande autour de la vue, dans un pool de poolCapacity textures
+ * réutilisées (la moins récemment dessinée est recyclée) : la mémoire vidéo ne dépend plus de la
+ * taille du labyrinthe. Au plus une tuile voisine de la vue est préparée par frame, pour que le
+ * défilement trouve la suivante déjà rendue.
+ * @note Après build(), le cache n'est utilisé que par le thread de rendu.
+ */
+class ChunkCache
+{
+public:
+    using DrawStatic = std::function<void(sf::RenderTarget &)>;
+
+    /**
+     * @brief Prépare le découpage du monde ; les tuiles sont rendues au premier draw() qui les montre
+     * @param worldSize Taille du monde à couvrir
+     * @param drawStatic Dessine le décor statique sur la cible (la vue de la tuile est déjà appliquée) ;
+     * appelé depuis le thread de rendu, ce qu'il lit doit rester valide tant que le cache existe
+     * @return false si le monde est vide (l'appelant dessine alors le décor directement)
+     */
+    bool build(const sf::Vector2f &worldSize, DrawStatic drawStatic);
+
+    void clear();
+
+    // false aussi si une RenderTexture n'a pas pu être créée : le rendu dessine alors le décor directement
+    bool isBuilt() const { return columns > 0 && !failed; }
+
+    /**
+     * @brief Dessine les tuiles qui recouvrent la vue courante de la cible (rend celles qui manquent)
+     */
+    void draw(sf::RenderTarget &target, CullingStats &stats);
+
+    static constexpr unsigned chunkSize = 512;
+    // 16 tuiles de 512x512 (16 Mo) : la vue et une couronne de tuiles autour
+    static constexpr std::size_t poolCapacity = 16;
+
+private:
+    struct Slot
+    {
+        std::unique_ptr<sf::RenderTexture> texture;
+        int chunk = -1;            // tuile rendue dans la texture (-1 : libre)
+        std::uint64_t lastUsed = 0; // dernière frame où la tuile a été dessinée
+    };
+
+    DrawStatic drawStatic;
+    std::vector<Slot> pool;
+    std::vector<int> slotOfChunk; // par tuile du monde : case du pool, -1 si elle n'est pas rendue
+    std::uint64_t frame = 0;
+    int columns = 0;
+    int rows = 0;
+    bool failed = false;
+    // Tuiles de la vue et de sa couronne (colonnes, lignes) : recyclées en dernier
+    sf::IntRect keep;
+
+    // Case du pool contenant la tuile, rendue si besoin ; -1 si aucune texture n'a pu être créée
+    int acquire(int chunk);
+    // Case à recycler : la moins récemment dessinée hors de keep, sinon (outsideKeepOnly faux)
+    // la moins récemment dessinée qui n'a pas servi à cette frame ; -1 si aucune
+    int findVictim(bool outsideKeepOnly) const;
+    bool isKept(int chunk) const;
+    void render(Slot &slot, int chunk);
+};
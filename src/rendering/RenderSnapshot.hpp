@@ -0,0 +1,71 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "SpriteBatch.hpp"
+#include "ChunkCache.hpp"
+#include "../environnement/StaticGeometry.hpp"
+#include "../environnement/VisibilityGrid.hpp"
+#include "../ui/Minimap.hpp"
+#include "../ui/UIViews.hpp"
+
+/**
+ * @brief Visuels d'un niveau construits une fois à sa génération, puis seulement lus par le rendu.
+ *
+ * Partagés entre le niveau courant et les instantanés en vol : l'ancien niveau reste
+ * vivant tant que le thread de rendu dessine un instantané qui le référence.
+ */
+struct LevelVisuals
+{
+    StaticGeometry staticGeometry;
+    ChunkCache chunkCache;
+    Minimap minimap;
+};
+
+/**
+ * @brief Tout ce que le thread de rendu doit savoir d'un tick de simulation.
+ *
+ * Rempli par la simulation dans le tampon arrière de RenderThread, puis dessiné tel quel :
+ * le rendu ne touche plus aux personnages, objets ni au niveau en cours de mise à jour.
+ */
+struct RenderSnapshot
+{
+    std::shared_ptr<LevelVisuals> level;
+    sf::View view;
+    bool mapView = false;
+    sf::Vector2f playerPosition;
+    Minimap::Explored explored;
+
+    // Pause, inventaire ou fenêtre sans focus : la simulation ne remplit ni la vue, ni les sprites,
+    // ni les barres de vie, ni les hints ; le rendu réaffiche le dernier monde reçu
+    bool worldFrozen = false;
+
+    // Objets et personnages visibles, déjà transformés (voir SpriteBatch)
+    SpriteBatch sprites;
+    CullingStats culling;
+
+    // Hints "[E]" au-dessus d'un coffre ou d'une porte de sortie proche
+    bool showChestHint = false;
+    sf::Vector2f chestHintPosition;
+    bool showDoorHint = false;
+    sf::Vector2f doorHintPosition;
+
+    std::vector<HealthBarView> healthBars;
+    HudView hud;
+    std::vector<std::string> notifications;
+
+    bool inventoryOpen = false;
+    InventoryView inventory;
+
+    bool pauseMenuVisible = false;
+    int pauseSelection = 0;
+
+    bool showProfiler = false;
+
+    // Premier appui ou relâchement de touche traité par ce tick : le rendu mesure la latence
+    // entrée -> affichage à la fin du display() qui le montre (voir DevMode::addInputLatency)
+    bool hasInputEvent = false;
+    std::chrono::steady_clock::time_point inputEventTime;
+};
@@ -0,0 +1,247 @@
+#include "RenderThread.hpp"
+#include "../DevMode.hpp"
+#include "../resources/FontService.hpp"
+#include "../profiling/FrameProfiler.hpp"
+#include "../profiling/TraceRecorder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+RenderThread::RenderThread(sf::RenderWindow &window, const sf::Sprite &background, DevMode *dev)
+    : window(window), background(background), dev(dev)
+{
+    // Hints "[E]" construits une fois à une taille préchauffée (FontService::characterSizes) :
+    // seules la position et l'échelle changent d'une frame à l'autre, aucun glyphe n'est rastérisé en jeu
+    const sf::Font &font = FontService::getFont();
+    chestHint = sf::Text("[E]", font, hintCharacterSize);
+    chestHint.setFillColor(sf::Color::Yellow);
+    doorHint = sf::Text("[E] Next Level", font, hintCharacterSize);
+    doorHint.setFillColor(sf::Color::Cyan);
+}
+
+RenderThread::~RenderThread()
+{
+    stop();
+}
+
+void RenderThread::start()
+{
+    if (running.exchange(true))
+        return;
+    // Un contexte OpenGL n'est actif que sur un thread à la fois
+    window.setActive(false);
+    thread = std::thread(&RenderThread::run, this);
+}
+
+void RenderThread::stop()
+{
+    if (!running.exchange(false))
+        return;
+    if (thread.joinable())
+        thread.join();
+}
+
+void RenderThread::run()
+{
+    TRACE_THREAD_NAME("render");
+    window.setActive(true);
+    createScene();
+
+    while (running.load(std::memory_order_acquire))
+    {
+        // Rien de nouveau : on ne redessine pas la même frame
+        if (!snapshots.consume())
+        {
+            sf::sleep(sf::milliseconds(1));
+            continue;
+        }
+
+        {
+            PROFILE_SCOPE(RenderSubmit);
+            draw(snapshots.front());
+        }
+        TRACE_COUNTER("sprite_batch_draws", spriteBatchDraws);
+        {
+            PROFILE_SCOPE(Display);
+            window.display();
+        }
+        presented.store(true, std::memory_order_release);
+
+        // Latence entrée -> affichage (vsync compris : display() rend la main après l'échange)
+        const RenderSnapshot &shown = snapshots.front();
+        if (shown.hasInputEvent)
+        {
+            const auto latency = std::chrono::steady_clock::now() - shown.inputEventTime;
+            TRACE_COUNTER("input_latency_us", std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+            if (dev)
+                dev->addInputLatency(std::chrono::duration<float, std::milli>(latency).count());
+        }
+    }
+
+    window.setActive(false);
+}
+
+/**
+ * @brief Crée la scène interne et calcule sa mise à l'échelle vers la fenêtre
+ */
+void RenderThread::createScene()
+{
+    sceneReady = false;
+    sceneHoldsWorld = false;
+    const sf::Vector2u windowSize = window.getSize();
+    if (internalHeight == 0 || windowSize.y == 0)
+        return;
+
+    // Même format que la fenêtre : la vue du jeu n'est pas déformée
+    const unsigned height = std::min(internalHeight, windowSize.y);
+    const unsigned width = static_cast<unsigned>(std::lround(static_cast<double>(height) * windowSize.x / windowSize.y));
+    if (!scene.create(width, height))
+    {
+        std::cerr << "RenderThread: scène interne indisponible, rendu direct dans la fenêtre\n";
+        return;
+    }
+    scene.setSmooth(false);
+
+    // Facteur entier si possible (pixels nets), sinon ajustement au plus proche voisin
+    const float fit = std::min(static_cast<float>(windowSize.x) / width, static_cast<float>(windowSize.y) / height);
+    const float scale = fit >= 1.f ? std::floor(fit) : fit;
+    sceneSprite.setTexture(scene.getTexture(), true);
+    sceneSprite.setScale(scale, scale);
+    sceneSprite.setPosition(std::floor((windowSize.x - width * scale) / 2.f), std::floor((windowSize.y - height * scale) / 2.f));
+    sceneReady = true;
+}
+
+sf::Vector2f RenderThread::worldToWindow(const sf::Vector2f &point, const sf::View &view) const
+{
+    if (!sceneReady)
+        return sf::Vector2f(window.mapCoordsToPixel(point, view));
+    return sceneSprite.getTransform().transformPoint(sf::Vector2f(scene.mapCoordsToPixel(point, view)));
+}
+
+/**
+ * @brief Garde le monde d'un instantané non figé ; l'instantané repart avec l'ancien monde,
+ * que la simulation videra avant de le remplir
+ */
+void RenderThread::retainWorld(RenderSnapshot &snapshot)
+{
+    world.level = snapshot.level;
+    world.view = snapshot.view;
+    std::swap(world.sprites, snapshot.sprites);
+    world.culling = snapshot.culling;
+    world.healthBars.swap(snapshot.healthBars);
+    world.showChestHint = snapshot.showChestHint;
+    world.chestHintPosition = snapshot.chestHintPosition;
+    world.showDoorHint = snapshot.showDoorHint;
+    world.doorHintPosition = snapshot.doorHintPosition;
+}
+
+/**
+ * @brief Décor, sprites et barres de vie du monde retenu, dans la vue du jeu
+ */
+void RenderThread::drawWorld(sf::RenderTarget &target)
+{
+    target.setView(world.view);
+
+    // Compteurs des objets retenus, complétés par ceux du décor de ce dessin (jamais cumulés d'une frame à l'autre)
+    drawnCulling = world.culling;
+
+    // Décor statique : tuiles du cache (ou fond + géométrie si le cache n'a pas pu être créé)
+    if (world.level->chunkCache.isBuilt())
+        world.level->chunkCache.draw(target, drawnCulling);
+    else
+    {
+        target.draw(background);
+        world.level->staticGeometry.draw(target, drawnCulling);
+    }
+
+    // Objets et personnages visibles : un seul lot de sprites (gardé pour les frames figées)
+    world.sprites.draw(target);
+    spriteBatchDraws = world.sprites.getDrawCallCount();
+
+    ui.drawHealthBars(target, world.healthBars);
+}
+
+/**
+ * @brief Dessine un instantané : monde (ou carte), puis HUD, notifications et menus en vue par défaut
+ */
+void RenderThread::draw(RenderSnapshot &snapshot)
+{
+    window.clear();
+    spriteBatchDraws = 0;
+    if (!snapshot.level)
+        return;
+
+    if (!snapshot.worldFrozen)
+        retainWorld(snapshot);
+
+    if (snapshot.mapView)
+    {
+        // Vue carte : texture précalculée + marqueurs, le monde n'est pas redessiné
+        snapshot.level->minimap.draw(window, snapshot.playerPosition, snapshot.explored);
+    }
+    else if (world.level)
+    {
+        if (sceneReady)
+        {
+            // Monde figé : la scène déjà rendue est réaffichée telle quelle
+            if (!snapshot.worldFrozen || !sceneHoldsWorld)
+            {
+                scene.clear();
+                drawWorld(scene);
+                scene.display();
+                sceneHoldsWorld = true;
+            }
+            window.setView(window.getDefaultView());
+            window.draw(sceneSprite);
+        }
+        else
+            drawWorld(window);
+
+        // Hints "[E]" à la résolution native, à la même taille apparente qu'en jeu
+        window.setView(window.getDefaultView());
+        const float pixelsPerUnit = static_cast<float>(window.getSize().x) / world.view.getSize().x;
+        if (world.showChestHint)
+        {
+            const float scale = 20.f * pixelsPerUnit / hintCharacterSize;
+            chestHint.setScale(scale, scale);
+            chestHint.setPosition(worldToWindow(world.chestHintPosition, world.view));
+            window.draw(chestHint);
+        }
+        if (world.showDoorHint)
+        {
+            const float scale = 18.f * pixelsPerUnit / hintCharacterSize;
+            doorHint.setScale(scale, scale);
+            doorHint.setPosition(worldToWindow(world.doorHintPosition, world.view));
+            window.draw(doorHint);
+        }
+
+        if (dev)
+            dev->setCullingStats(drawnCulling);
+    }
+
+    // Draw player HUD (HP, Mana, Stamina, Level) at bottom-left
+    ui.drawPlayerHUD(window, snapshot.hud);
+    // Draw ephemeral notifications (right side)
+    ui.setNotificationTexts(snapshot.notifications);
+    ui.drawNotifications(window);
+
+    // Inventaire et menu de pause en vue par défaut
+    if (snapshot.inventoryOpen || snapshot.pauseMenuVisible)
+    {
+        window.setView(window.getDefaultView());
+        if (snapshot.inventoryOpen)
+            ui.drawInventoryMenu(window, snapshot.inventory);
+        if (snapshot.pauseMenuVisible)
+        {
+            pauseMenu.setSelectedOption(static_cast<PauseMenu::MenuOption>(snapshot.pauseSelection));
+            pauseMenu.draw(window);
+        }
+    }
+
+    // Profiler (F3) : graphe des temps de frame et détail par étape
+    if (snapshot.showProfiler && dev)
+    {
+        window.setView(window.getDefaultView());
+        dev->drawProfiler(window);
+    }
+}
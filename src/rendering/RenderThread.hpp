@@ -0,0 +1,109 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <thread>
+#include "Renderer.hpp"
+#include "TripleBuffer.hpp"
+#include "../ui/UIManager.hpp"
+#include "../ui/PauseMenu.hpp"
+
+class DevMode;
+
+/**
+ * @brief Thread dédié au dessin et à window.display().
+ *
+ * La simulation remplit beginSnapshot() puis publish() à chaque tick ; le thread de rendu
+ * dessine le dernier instantané publié. Les deux côtés communiquent par un triple tampon
+ * sans verrou : un display() lent (vsync, limite de framerate) ne retarde plus la simulation.
+ *
+ * La fenêtre reste créée et vidée de ses événements par le thread principal (exigence de SFML) ;
+ * seul son contexte OpenGL est activé sur le thread de rendu entre start() et stop().
+ *
+ * Le monde est rendu dans une texture interne de hauteur fixe (la largeur suit le format de la
+ * fenêtre), agrandie au plus proche voisin, d'un facteur entier quand il tient dans la fenêtre :
+ * le coût du rendu ne dépend plus de la résolution de l'écran. HUD, menus et textes sont
+ * dessinés par-dessus à la résolution native.
+ *
+ * En pause ou dans l'inventaire, le monde ne bouge plus : la simulation ne construit plus que
+ * l'interface (RenderSnapshot::worldFrozen) et le rendu réaffiche le dernier monde reçu, qu'il
+ * garde de côté ; avec la scène interne, celle-ci est réaffichée sans redessiner décor ni sprites.
+ */
+class RenderThread : public Renderer
+{
+public:
+    /**
+     * @param window La fenêtre de rendu
+     * @param background Le fond, dessiné directement si le cache de tuiles n'a pas pu être créé
+     * @param dev Reçoit les compteurs du culling et les latences entrée -> affichage (peut être nullptr)
+     */
+    RenderThread(sf::RenderWindow &window, const sf::Sprite &background, DevMode *dev);
+    ~RenderThread() override;
+
+    /**
+     * @brief Hauteur de la scène interne (0 = rendu direct dans la fenêtre)
+     * @note À appeler avant start()
+     */
+    void setInternalHeight(unsigned height) { internalHeight = height; }
+
+    void start();
+    void stop();
+
+    // Côté simulation : instantané à remplir, puis à publier
+    RenderSnapshot &beginSnapshot() override { return snapshots.back(); }
+    void publish() override { snapshots.publish(); }
+
+    // true dès que la première frame a été affichée
+    bool hasPresentedFrame() const { return presented.load(std::memory_order_acquire); }
+
+private:
+    sf::RenderWindow &window;
+    const sf::Sprite &background;
+    DevMode *dev;
+
+    TripleBuffer<RenderSnapshot> snapshots;
+    std::thread thread;
+    std::atomic<bool> running{false};
+    std::atomic<bool> presented{false};
+
+    // Scène interne à basse résolution et sa mise à l'échelle vers la fenêtre
+    unsigned internalHeight = 360;
+    sf::RenderTexture scene;
+    bool sceneReady = false;
+    bool sceneHoldsWorld = false; // la scène contient une frame du monde (réutilisée en pause)
+    sf::Sprite sceneSprite;
+
+    // Dernier monde reçu (échangé avec l'instantané, pas copié) : redessiné tant que le monde est figé
+    struct RetainedWorld
+    {
+        std::shared_ptr<LevelVisuals> level;
+        sf::View view;
+        SpriteBatch sprites;
+        CullingStats culling;
+        std::vector<HealthBarView> healthBars;
+        bool showChestHint = false;
+        sf::Vector2f chestHintPosition;
+        bool showDoorHint = false;
+        sf::Vector2f doorHintPosition;
+    };
+    RetainedWorld world;
+    // Compteurs du dernier dessin du monde : ceux du monde retenu plus ceux du décor
+    CullingStats drawnCulling;
+    // Appels de dessin du lot de sprites à cette frame (0 si la scène figée est réaffichée)
+    unsigned spriteBatchDraws = 0;
+
+    // État propre au rendu (caches de géométrie et de texte)
+    UIManager ui;
+    PauseMenu pauseMenu;
+    sf::Text chestHint;
+    sf::Text doorHint;
+    // Taille des hints, préchauffée par FontService ; la taille apparente est obtenue par l'échelle
+    static constexpr unsigned hintCharacterSize = 60;
+
+    void run();
+    void createScene();
+    void draw(RenderSnapshot &snapshot);
+    void retainWorld(RenderSnapshot &snapshot);
+    void drawWorld(sf::RenderTarget &target);
+    // Position dans la fenêtre (vue par défaut) d'un point du monde
+    sf::Vector2f worldToWindow(const sf::Vector2f &point, const sf::View &view) const;
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include "RenderSnapshot.hpp"
+
+/**
+ * @brief Destination des instantanés produits par la simulation à chaque tick.
+ *
+ * La boucle de jeu remplit beginSnapshot() puis appelle publish() ; elle ignore qui dessine.
+ * RenderThread dessine dans la fenêtre, NullRenderer jette tout (simulation sans affichage).
+ */
+class Renderer
+{
+public:
+    virtual ~Renderer() = default;
+
+    // Instantané à remplir pour le tick courant
+    virtual RenderSnapshot &beginSnapshot() = 0;
+    // Rend l'instantané rempli disponible pour l'affichage
+    virtual void publish() = 0;
+};
+
+/**
+ * @brief Renderer sans affichage : aucune fenêtre, aucun contexte OpenGL.
+ *
+ * Un seul instantané, vidé à chaque publication ; utile pour les benchmarks et les
+ * processus sans GPU (avec TextureAtlas::setHeadless(true)).
+ */
+class NullRenderer : public Renderer
+{
+public:
+    RenderSnapshot &beginSnapshot() override { return snapshot; }
+
+    void publish() override
+    {
+        snapshot.sprites.clear();
+        ++publishedCount;
+    }
+
+    unsigned long long getPublishedCount() const { return publishedCount; }
+
+private:
+    RenderSnapshot snapshot;
+    unsigned long long publishedCount = 0;
+};
@@ -0,0 +1,58 @@
+#include "SpriteBatch.hpp"
+#include <algorithm>
+#include <cmath>
+
+// Remplissage du lot, sans GPU (game_core) ; dessin et shader dans SpriteBatchDraw.cpp (cible main)
+
+void SpriteBatch::submit(const sf::Sprite &sprite, const sf::Transform &transform, Layer layer, float flash)
+{
+    const sf::Texture *texture = sprite.getTexture();
+    if (!texture)
+        return;
+
+    std::size_t textureIndex = 0;
+    while (textureIndex < textures.size() && textures[textureIndex] != texture)
+        ++textureIndex;
+    if (textureIndex == textures.size())
+        textures.push_back(texture);
+
+    Command command;
+    command.key = (static_cast<std::uint64_t>(layer) << 48) | (static_cast<std::uint64_t>(textureIndex & 0xFFFF) << 32) | static_cast<std::uint64_t>(commands.size());
+    command.texture = texture;
+    command.flashLevel = toFlashLevel(flash);
+    buildQuad(command.quad, sprite, transform);
+    commands.push_back(command);
+}
+
+void SpriteBatch::clear()
+{
+    commands.clear();
+    textures.clear();
+}
+
+/**
+ * @brief Construit les 4 sommets d'un sprite, comme le ferait sf::Sprite, déjà transformés.
+ */
+void SpriteBatch::buildQuad(sf::Vertex *quad, const sf::Sprite &sprite, const sf::Transform &transform)
+{
+    const sf::IntRect &rect = sprite.getTextureRect();
+    const float width = static_cast<float>(std::abs(rect.width));
+    const float height = static_cast<float>(std::abs(rect.height));
+    const float left = static_cast<float>(rect.left);
+    const float right = left + static_cast<float>(rect.width);
+    const float top = static_cast<float>(rect.top);
+    const float bottom = top + static_cast<float>(rect.height);
+
+    const sf::Color color = sprite.getColor();
+    quad[0] = sf::Vertex(transform.transformPoint(0.f, 0.f), color, sf::Vector2f(left, top));
+    quad[1] = sf::Vertex(transform.transformPoint(width, 0.f), color, sf::Vector2f(right, top));
+    quad[2] = sf::Vertex(transform.transformPoint(width, height), color, sf::Vector2f(right, bottom));
+    quad[3] = sf::Vertex(transform.transformPoint(0.f, height), color, sf::Vector2f(left, bottom));
+}
+
+std::uint8_t SpriteBatch::toFlashLevel(float flash)
+{
+    if (flash <= 0.f)
+        return 0;
+    return static_cast<std::uint8_t>(std::lround(std::min(flash, 1.f) * flashLevels));
+}
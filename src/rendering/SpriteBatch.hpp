@@ -0,0 +1,88 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Regroupe les sprites d'une frame (personnages, objets, portes) en un minimum d'appels de dessin.
+ *
+ * Les sprites sont soumis avec leur couche, leur texture, leur rectangle d'atlas, leur
+ * transformation, leur teinte et leur niveau de flash. flush() les trie par clé
+ * (couche, texture, ordre de soumission) puis dessine chaque suite de même texture en un appel.
+ *
+ * Le flash de dégâts est un attribut de sommet : il est encodé dans la coordonnée de texture
+ * (décalage de 2 * niveau en coordonnées normalisées) au moment du flush et décodé par le shader
+ * du lot, ce qui évite de changer de shader ou d'uniform entre deux sprites. submit() ne touche
+ * pas au GPU : un lot peut être rempli par une simulation sans fenêtre.
+ * @note L'encodage suppose des coordonnées normalisées exactes (textures de taille puissance de deux,
+ * ce que garantit l'atlas, ou support des textures NPOT).
+ * @note submit() et clear() font partie de game_core ; draw(), flush(), drawImmediate() et le shader
+ * sont compilés avec le rendu (SpriteBatchDraw.cpp, cible main).
+ */
+class SpriteBatch
+{
+public:
+    // Couches de dessin, dans l'ordre
+    enum Layer : std::uint16_t
+    {
+        Objects = 0,
+        Characters = 1
+    };
+
+    /**
+     * @brief Ajoute un sprite au lot
+     * @param sprite Le sprite (texture, rectangle, teinte)
+     * @param transform Transformation appliquée (généralement sprite.getTransform())
+     * @param layer Couche de dessin
+     * @param flash Niveau de flash blanc (0 = normal, 1 = tout blanc)
+     */
+    void submit(const sf::Sprite &sprite, const sf::Transform &transform, Layer layer, float flash = 0.f);
+
+    /**
+     * @brief Dessine et vide le lot (rendu uniquement)
+     */
+    void flush(sf::RenderTarget &target);
+
+    /**
+     * @brief Dessine le lot sans le vider (lot retenu, redessiné tant que le monde est figé)
+     */
+    void draw(sf::RenderTarget &target);
+
+    /**
+     * @brief Vide le lot sans le dessiner (réutilisation d'un instantané non consommé)
+     */
+    void clear();
+
+    /**
+     * @brief Nombre d'appels de dessin du dernier flush
+     */
+    unsigned getDrawCallCount() const { return drawCalls; }
+
+    /**
+     * @brief Dessine immédiatement un seul sprite avec le shader du lot (chemin hors lot : debug, menus)
+     */
+    static void drawImmediate(sf::RenderTarget &target, const sf::Sprite &sprite, const sf::Transform &transform, float flash);
+
+private:
+    struct Command
+    {
+        std::uint64_t key;
+        const sf::Texture *texture;
+        std::uint8_t flashLevel;
+        sf::Vertex quad[4];
+    };
+
+    std::vector<Command> commands;
+    std::vector<const sf::Texture *> textures; // index de texture de la frame (pour la clé de tri)
+    std::vector<sf::Vertex> vertices;
+    unsigned drawCalls = 0;
+
+    static constexpr int flashLevels = 15;
+
+    static void buildQuad(sf::Vertex *quad, const sf::Sprite &sprite, const sf::Transform &transform);
+    static std::uint8_t toFlashLevel(float flash);
+    static void encodeFlash(sf::Vertex *quad, std::uint8_t level, const sf::Texture &texture);
+
+    // Shader partagé décodant le flash ; nullptr si les shaders ne sont pas disponibles
+    static sf::Shader *getShader();
+};
@@ -0,0 +1,112 @@
+#include "SpriteBatch.hpp"
+#include <algorithm>
+#include <iostream>
+
+// Dessin du lot et shader du flash : compilés avec le rendu (cible main), pas avec game_core,
+// qui ne fait que remplir des lots (SpriteBatch.cpp)
+
+namespace
+{
+    // Le niveau de flash est la partie entière de uv.x / 2 (voir SpriteBatch::buildQuad)
+    const char *BatchShaderCode = R"(
+    uniform sampler2D texture;
+
+    void main() {
+        vec2 uv = gl_TexCoord[0].xy;
+        float level = floor(uv.x * 0.5);
+        uv.x -= 2.0 * level;
+        vec4 pixel = texture2D(texture, uv) * gl_Color;
+        gl_FragColor = vec4(mix(pixel.rgb, vec3(1.0, 1.0, 1.0), level / 15.0), pixel.a);
+    }
+    )";
+}
+
+void SpriteBatch::flush(sf::RenderTarget &target)
+{
+    draw(target);
+    clear();
+}
+
+void SpriteBatch::draw(sf::RenderTarget &target)
+{
+    drawCalls = 0;
+    if (commands.empty())
+        return;
+
+    std::sort(commands.begin(), commands.end(), [](const Command &a, const Command &b)
+              { return a.key < b.key; });
+
+    // Le flash n'est encodé qu'ici : remplir le lot ne demande ni contexte OpenGL ni shader
+    sf::Shader *shader = getShader();
+    vertices.clear();
+    vertices.reserve(commands.size() * 4);
+    for (const auto &c : commands)
+    {
+        vertices.insert(vertices.end(), c.quad, c.quad + 4);
+        if (shader)
+            encodeFlash(&vertices[vertices.size() - 4], c.flashLevel, *c.texture);
+    }
+
+    std::size_t first = 0;
+    while (first < commands.size())
+    {
+        std::size_t last = first + 1;
+        while (last < commands.size() && commands[last].texture == commands[first].texture)
+            ++last;
+
+        sf::RenderStates states(commands[first].texture);
+        states.shader = shader;
+        target.draw(&vertices[first * 4], (last - first) * 4, sf::Quads, states);
+        ++drawCalls;
+        first = last;
+    }
+}
+
+void SpriteBatch::drawImmediate(sf::RenderTarget &target, const sf::Sprite &sprite, const sf::Transform &transform, float flash)
+{
+    if (!sprite.getTexture())
+        return;
+    sf::Shader *shader = getShader();
+    sf::Vertex quad[4];
+    buildQuad(quad, sprite, transform);
+    if (shader)
+        encodeFlash(quad, toFlashLevel(flash), *sprite.getTexture());
+    sf::RenderStates states(sprite.getTexture());
+    states.shader = shader;
+    target.draw(quad, 4, sf::Quads, states);
+}
+
+/**
+ * @brief Décale les coordonnées de texture d'un nombre pair de largeurs de texture :
+ * invisible après décodage par le shader, qui en déduit le niveau de flash.
+ */
+void SpriteBatch::encodeFlash(sf::Vertex *quad, std::uint8_t level, const sf::Texture &texture)
+{
+    if (level == 0)
+        return;
+    const float offset = 2.f * static_cast<float>(level) * static_cast<float>(texture.getSize().x);
+    for (int i = 0; i < 4; ++i)
+        quad[i].texCoords.x += offset;
+}
+
+/**
+ * @brief Retourne le shader du lot, compilé au premier appel.
+ * @note L'initialisation d'une statique locale est thread-safe : le lot est rempli par la
+ * simulation et dessiné par le thread de rendu.
+ */
+sf::Shader *SpriteBatch::getShader()
+{
+    static sf::Shader shader;
+    static sf::Shader *const loaded = []() -> sf::Shader *
+    {
+        if (!sf::Shader::isAvailable() || !shader.loadFromMemory(BatchShaderCode, sf::Shader::Fragment))
+        {
+            std::cerr << "SpriteBatch: shader indisponible, le flash de dégâts est désactivé" << std::endl;
+            return nullptr;
+        }
+        shader.setUniform("texture", sf::Shader::CurrentTexture);
+        return &shader;
+    }();
+
+    return loaded;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Triple tampon sans verrou entre un unique producteur et un unique consommateur.
+ *
+ * Le producteur remplit back() puis publish() l'échange avec l'emplacement du milieu ;
+ * le consommateur appelle consume() qui récupère le milieu s'il est plus récent que front().
+ * Aucun des deux côtés n'attend l'autre : le producteur écrase simplement un instantané
+ * que le consommateur n'a pas encore pris.
+ *
+ * @note back() peut rendre un emplacement contenant un ancien instantané : le producteur
+ * doit réinitialiser ce qu'il réécrit (les vecteurs gardent leur capacité d'un tick à l'autre).
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    T &back() { return slots[backIndex]; }
+    T &front() { return slots[frontIndex]; }
+
+    /**
+     * @brief Publie back() (côté producteur)
+     */
+    void publish()
+    {
+        std::uint8_t previous = middle.exchange(static_cast<std::uint8_t>(backIndex | freshBit), std::memory_order_acq_rel);
+        backIndex = previous & indexMask;
+    }
+
+    /**
+     * @brief Récupère le dernier instantané publié dans front() (côté consommateur)
+     * @return false si rien n'a été publié depuis le dernier appel
+     */
+    bool consume()
+    {
+        if (!(middle.load(std::memory_order_acquire) & freshBit))
+            return false;
+        std::uint8_t previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = previous & indexMask;
+        return true;
+    }
+
+private:
+    static constexpr std::uint8_t indexMask = 0x3;
+    static constexpr std::uint8_t freshBit = 0x4;
+
+    std::array<T, 3> slots;
+    std::atomic<std::uint8_t> middle{1};
+    std::uint8_t backIndex = 0;  // à l'usage exclusif du producteur
+    std::uint8_t frontIndex = 2; // à l'usage exclusif du consommateur
+};
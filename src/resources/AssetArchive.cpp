@@ -0,0 +1,224 @@
+#include "AssetArchive.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach-o/dyld.h>
+#endif
+#endif
+
+AssetArchive::~AssetArchive()
+{
+    close();
+}
+
+/**
+ * @brief Retourne l'archive par défaut, ouverte au premier appel.
+ */
+AssetArchive &AssetArchive::getDefault()
+{
+    static AssetArchive archive;
+    static bool isLoaded = false;
+
+    if (!isLoaded)
+    {
+        std::vector<std::string> candidates;
+        std::string exeDir = executableDirectory();
+        if (!exeDir.empty())
+            candidates.push_back(exeDir + "/assets.pak");
+#ifdef GAME_ASSET_ARCHIVE_PATH
+        candidates.push_back(GAME_ASSET_ARCHIVE_PATH);
+#endif
+        for (const auto &path : candidates)
+        {
+            if (archive.open(path))
+            {
+                std::cout << "AssetArchive: " << path << " (" << archive.entryCount << " fichiers)\n";
+                break;
+            }
+        }
+        if (!archive.isOpen())
+            std::cerr << "AssetArchive: aucune archive trouvée, lecture des assets depuis le disque\n";
+        isLoaded = true;
+    }
+
+    return archive;
+}
+
+/**
+ * @brief Projette l'archive en mémoire et valide son en-tête.
+ *
+ * @param path Chemin de l'archive
+ * @return true si l'archive est utilisable
+ */
+bool AssetArchive::open(const std::string &path)
+{
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        CloseHandle(file);
+        return false;
+    }
+    const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    base = static_cast<const char *>(view);
+    mappedSize = static_cast<std::size_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    void *view = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED)
+    {
+        ::close(fd);
+        return false;
+    }
+    fileDescriptor = fd;
+    base = static_cast<const char *>(view);
+    mappedSize = static_cast<std::size_t>(st.st_size);
+#endif
+
+    using namespace AssetArchiveFormat;
+    if (mappedSize < sizeof(Header) || std::memcmp(base, magic, sizeof(magic)) != 0)
+    {
+        std::cerr << "AssetArchive: " << path << " n'est pas une archive valide\n";
+        close();
+        return false;
+    }
+    const Header *header = reinterpret_cast<const Header *>(base);
+    if (sizeof(Header) + static_cast<std::size_t>(header->entryCount) * sizeof(IndexEntry) > mappedSize)
+    {
+        std::cerr << "AssetArchive: index tronqué dans " << path << "\n";
+        close();
+        return false;
+    }
+    entryCount = header->entryCount;
+    index = reinterpret_cast<const IndexEntry *>(base + sizeof(Header));
+    return true;
+}
+
+void AssetArchive::close()
+{
+    if (!base)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(base);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    munmap(const_cast<char *>(base), mappedSize);
+    ::close(fileDescriptor);
+    fileDescriptor = -1;
+#endif
+    base = nullptr;
+    mappedSize = 0;
+    index = nullptr;
+    entryCount = 0;
+}
+
+/**
+ * @brief Recherche dichotomique dans l'index trié par hash.
+ */
+AssetArchive::Entry AssetArchive::find(const std::string &name) const
+{
+    if (!base)
+        return {};
+
+    const std::uint64_t hash = AssetArchiveFormat::hashName(name);
+    const auto *last = index + entryCount;
+    const auto *it = std::lower_bound(index, last, hash, [](const AssetArchiveFormat::IndexEntry &e, std::uint64_t h)
+                                      { return e.hash < h; });
+
+    for (; it != last && it->hash == hash; ++it)
+    {
+        // Les collisions de hash sont départagées par le nom
+        if (it->dataOffset + it->dataSize <= mappedSize && entryName(*it) == name)
+            return {base + it->dataOffset, static_cast<std::size_t>(it->dataSize)};
+    }
+    return {};
+}
+
+std::vector<std::string> AssetArchive::list(const std::string &prefix) const
+{
+    std::vector<std::string> names;
+    for (std::uint32_t i = 0; i < entryCount; ++i)
+    {
+        std::string name = entryName(index[i]);
+        if (name.compare(0, prefix.size(), prefix) == 0)
+            names.push_back(std::move(name));
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+std::string AssetArchive::entryName(const AssetArchiveFormat::IndexEntry &e) const
+{
+    if (e.nameOffset + e.nameLength > mappedSize)
+        return std::string();
+    return std::string(base + e.nameOffset, e.nameLength);
+}
+
+/**
+ * @brief Retourne le dossier de l'exécutable, pour trouver l'archive quel que soit le dossier courant.
+ */
+std::string AssetArchive::executableDirectory()
+{
+    std::string path;
+#ifdef _WIN32
+    char buffer[MAX_PATH];
+    DWORD length = GetModuleFileNameA(nullptr, buffer, MAX_PATH);
+    if (length > 0 && length < MAX_PATH)
+        path.assign(buffer, length);
+#elif defined(__APPLE__)
+    char buffer[4096];
+    uint32_t size = sizeof(buffer);
+    if (_NSGetExecutablePath(buffer, &size) == 0)
+        path = buffer;
+#else
+    char buffer[4096];
+    ssize_t length = readlink("/proc/self/exe", buffer, sizeof(buffer) - 1);
+    if (length > 0)
+        path.assign(buffer, static_cast<std::size_t>(length));
+#endif
+    size_t slash = path.find_last_of("/\\");
+    if (slash == std::string::npos)
+        return std::string();
+    return path.substr(0, slash);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "AssetArchiveFormat.hpp"
+
+/**
+ * @brief Archive d'assets en lecture seule, projetée en mémoire (mmap / MapViewOfFile).
+ *
+ * L'archive est produite au build par l'outil pack_assets. Les données sont servies
+ * directement depuis la projection, sans copie, pour les loadFromMemory de SFML.
+ */
+class AssetArchive
+{
+public:
+    struct Entry
+    {
+        const char *data = nullptr;
+        std::size_t size = 0;
+    };
+
+    AssetArchive() = default;
+    ~AssetArchive();
+    AssetArchive(const AssetArchive &) = delete;
+    AssetArchive &operator=(const AssetArchive &) = delete;
+
+    /**
+     * @brief Archive par défaut : cherchée à côté de l'exécutable, puis au chemin fixé au build.
+     * @note Peut rester fermée (assets servis depuis le disque) si aucune archive n'est trouvée.
+     */
+    static AssetArchive &getDefault();
+
+    bool open(const std::string &path);
+    void close();
+    bool isOpen() const { return base != nullptr; }
+
+    /**
+     * @brief Cherche un fichier par son chemin relatif à src/assets ("images/brick.png")
+     * @return L'entrée, ou une entrée vide (data == nullptr) si absente
+     */
+    Entry find(const std::string &name) const;
+
+    /**
+     * @brief Liste (triée) des fichiers dont le chemin commence par prefix
+     */
+    std::vector<std::string> list(const std::string &prefix) const;
+
+private:
+    const char *base = nullptr;
+    std::size_t mappedSize = 0;
+    const AssetArchiveFormat::IndexEntry *index = nullptr;
+    std::uint32_t entryCount = 0;
+
+#ifdef _WIN32
+    void *fileHandle = nullptr;
+    void *mappingHandle = nullptr;
+#else
+    int fileDescriptor = -1;
+#endif
+
+    std::string entryName(const AssetArchiveFormat::IndexEntry &e) const;
+
+    // Dossier contenant l'exécutable (vide si introuvable)
+    static std::string executableDirectory();
+};
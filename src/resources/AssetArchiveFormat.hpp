@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Format de l'archive d'assets (assets.pak), partagé entre l'outil pack_assets et le jeu.
+ *
+ * Disposition (little-endian) :
+ *   [Header][IndexEntry x entryCount][noms][données alignées sur 16 octets]
+ *
+ * L'index est trié par hash (FNV-1a 64 bits du chemin relatif à src/assets, séparateur '/'),
+ * ce qui permet une recherche dichotomique sans rien construire au chargement.
+ */
+namespace AssetArchiveFormat
+{
+    constexpr char magic[8] = {'G', 'O', 'T', 'P', 'A', 'K', '1', '\0'};
+    constexpr std::uint64_t dataAlignment = 16;
+
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t entryCount;
+        std::uint32_t reserved;
+    };
+
+    struct IndexEntry
+    {
+        std::uint64_t hash;
+        std::uint64_t nameOffset; // depuis le début du fichier
+        std::uint64_t dataOffset; // depuis le début du fichier
+        std::uint64_t dataSize;
+        std::uint32_t nameLength;
+        std::uint32_t reserved;
+    };
+
+    static_assert(sizeof(Header) == 16, "Header must stay 16 bytes");
+    static_assert(sizeof(IndexEntry) == 40, "IndexEntry must stay 40 bytes");
+
+    inline std::uint64_t hashName(const std::string &name)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (unsigned char c : name)
+        {
+            hash ^= c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+}
@@ -0,0 +1,182 @@
+#include "AssetLoader.hpp"
+#include "AssetArchive.hpp"
+#include "../profiling/TraceRecorder.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#ifndef GAME_ASSET_SOURCE_DIR
+#define GAME_ASSET_SOURCE_DIR "../src/assets/"
+#endif
+
+/**
+ * @brief Retourne le chargeur partagé (les threads de travail démarrent au premier appel).
+ */
+AssetLoader &AssetLoader::getInstance()
+{
+    static AssetLoader instance;
+    return instance;
+}
+
+/**
+ * @brief Démarre les threads de travail (au plus maxWorkers, au moins 1).
+ */
+AssetLoader::AssetLoader()
+{
+    unsigned count = std::max(1u, std::min(maxWorkers, std::thread::hardware_concurrency()));
+    for (unsigned i = 0; i < count; ++i)
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+}
+
+/**
+ * @brief Termine les tâches restantes puis arrête les threads.
+ */
+AssetLoader::~AssetLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    condition.notify_all();
+    for (auto &w : workers)
+        w.join();
+}
+
+AssetLoader::ImageHandle AssetLoader::requestImage(const std::string &id)
+{
+    // Ouvre l'archive avant de verrouiller (les workers la lisent ensuite sans synchronisation)
+    const AssetArchive &archive = AssetArchive::getDefault();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = images.find(id);
+    if (it != images.end())
+        return it->second;
+
+    auto promise = std::make_shared<std::promise<std::shared_ptr<const sf::Image>>>();
+    ImageHandle handle = promise->get_future().share();
+    images[id] = handle;
+
+    tasks.emplace_back([id, promise, &archive]()
+                       {
+        TRACE_SCOPE("decode_image");
+        auto image = std::make_shared<sf::Image>();
+        AssetArchive::Entry entry = archive.find(id);
+        bool loaded = entry.data ? image->loadFromMemory(entry.data, entry.size)
+                                 : image->loadFromFile(sourcePath(id));
+        if (loaded)
+            promise->set_value(std::move(image));
+        else
+        {
+            std::cerr << "AssetLoader: impossible de décoder " << id << "\n";
+            promise->set_value(nullptr);
+        } });
+    condition.notify_one();
+    return handle;
+}
+
+AssetLoader::FileHandle AssetLoader::requestFile(const std::string &id)
+{
+    const AssetArchive &archive = AssetArchive::getDefault();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = files.find(id);
+    if (it != files.end())
+        return it->second;
+
+    auto promise = std::make_shared<std::promise<std::shared_ptr<const FileData>>>();
+    FileHandle handle = promise->get_future().share();
+    files[id] = handle;
+
+    // Dans l'archive : les octets sont déjà en mémoire, pas besoin de passer par un worker
+    AssetArchive::Entry entry = archive.find(id);
+    if (entry.data)
+    {
+        auto file = std::make_shared<FileData>();
+        file->data = entry.data;
+        file->size = entry.size;
+        promise->set_value(std::move(file));
+        return handle;
+    }
+
+    tasks.emplace_back([id, promise]()
+                       {
+        std::ifstream in(sourcePath(id), std::ios::binary);
+        if (!in)
+        {
+            std::cerr << "AssetLoader: fichier introuvable " << id << "\n";
+            promise->set_value(nullptr);
+            return;
+        }
+        auto file = std::make_shared<FileData>();
+        file->storage.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        file->data = file->storage.data();
+        file->size = file->storage.size();
+        promise->set_value(std::move(file)); });
+    condition.notify_one();
+    return handle;
+}
+
+bool AssetLoader::loadFont(sf::Font &font, const std::string &id)
+{
+    std::shared_ptr<const FileData> file = requestFile(id).get();
+    if (!file || file->size == 0)
+        return false;
+    return font.loadFromMemory(file->data, file->size);
+}
+
+/**
+ * @brief Liste les assets d'un sous-dossier, depuis l'archive ou à défaut depuis le disque.
+ */
+std::vector<std::string> AssetLoader::listAssets(const std::string &prefix) const
+{
+    const AssetArchive &archive = AssetArchive::getDefault();
+    if (archive.isOpen())
+        return archive.list(prefix);
+
+    namespace fs = std::filesystem;
+    const std::string root = sourcePath("");
+    std::vector<std::string> ids;
+    std::error_code ec;
+    for (const auto &entry : fs::recursive_directory_iterator(sourcePath(prefix), ec))
+    {
+        std::string path = entry.path().generic_string();
+        if (entry.is_regular_file() && path.compare(0, root.size(), root) == 0)
+            ids.push_back(path.substr(root.size()));
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+void AssetLoader::releaseImages()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    images.clear();
+}
+
+std::string AssetLoader::sourcePath(const std::string &id)
+{
+    return std::string(GAME_ASSET_SOURCE_DIR) + id;
+}
+
+/**
+ * @brief Boucle d'un thread de travail : exécute les tâches jusqu'à l'arrêt du chargeur.
+ */
+void AssetLoader::workerLoop()
+{
+    TRACE_THREAD_NAME("asset_loader");
+    for (;;)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]()
+                           { return stopping || !tasks.empty(); });
+            if (tasks.empty())
+                return;
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
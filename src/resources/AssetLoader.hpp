@@ -0,0 +1,98 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Chargeur d'assets asynchrone.
+ *
+ * Le décodage des images (PNG -> sf::Image) et la lecture des fichiers bruts (polices)
+ * se font sur des threads de travail. Seul l'envoi des textures au GPU reste sur le thread
+ * qui possède le contexte OpenGL : l'appelant attend le handle puis crée sa texture.
+ *
+ * Les assets sont désignés par leur chemin relatif à src/assets ("images/brick.png",
+ * "fonts/RobotoMono-Regular.ttf") : ils sont lus dans l'archive assets.pak si elle est présente,
+ * sinon dans le dossier des sources fixé au build. Le jeu fonctionne donc quel que soit le dossier courant.
+ *
+ * Les requêtes sont mises en cache par identifiant : demander deux fois le même fichier
+ * retourne le même handle.
+ */
+class AssetLoader
+{
+public:
+    using ImageHandle = std::shared_future<std::shared_ptr<const sf::Image>>;
+
+    /**
+     * @brief Contenu d'un fichier : pointe dans l'archive projetée, ou dans storage s'il a été lu sur disque
+     */
+    struct FileData
+    {
+        const char *data = nullptr;
+        std::size_t size = 0;
+        std::vector<char> storage;
+    };
+    using FileHandle = std::shared_future<std::shared_ptr<const FileData>>;
+
+    static AssetLoader &getInstance();
+
+    ~AssetLoader();
+    AssetLoader(const AssetLoader &) = delete;
+    AssetLoader &operator=(const AssetLoader &) = delete;
+
+    /**
+     * @brief Demande le décodage d'une image en tâche de fond
+     * @return Un handle dont get() bloque jusqu'au décodage (nullptr si le chargement a échoué)
+     */
+    ImageHandle requestImage(const std::string &id);
+
+    /**
+     * @brief Demande la lecture complète d'un fichier en tâche de fond (polices, etc.)
+     * @return Un handle dont get() bloque jusqu'à la lecture (nullptr si le fichier est introuvable)
+     * @note Les octets restent valides tant qu'un handle existe (nécessaire pour sf::Font::loadFromMemory)
+     */
+    FileHandle requestFile(const std::string &id);
+
+    /**
+     * @brief Charge une police depuis les octets lus par requestFile (attend la lecture si besoin)
+     * @note Les octets restent dans le cache du chargeur, ils survivent donc à la police (exigence de SFML)
+     * @return true si la police a été chargée
+     */
+    bool loadFont(sf::Font &font, const std::string &id);
+
+    /**
+     * @brief Liste (triée) des assets dont l'identifiant commence par prefix ("images/")
+     */
+    std::vector<std::string> listAssets(const std::string &prefix) const;
+
+    /**
+     * @brief Oublie les images en cache (celles encore référencées par un handle restent valides)
+     */
+    void releaseImages();
+
+private:
+    AssetLoader();
+
+    void workerLoop();
+
+    // Chemin sur disque d'un asset absent de l'archive
+    static std::string sourcePath(const std::string &id);
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stopping = false;
+
+    std::unordered_map<std::string, ImageHandle> images;
+    std::unordered_map<std::string, FileHandle> files;
+
+    static constexpr unsigned maxWorkers = 4;
+};
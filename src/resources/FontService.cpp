@@ -0,0 +1,61 @@
+#include "FontService.hpp"
+#include "AssetLoader.hpp"
+#include <iostream>
+
+namespace
+{
+    struct LoadedFont
+    {
+        sf::Font font;
+        bool loaded = false;
+    };
+
+    LoadedFont &getLoadedFont()
+    {
+        static LoadedFont instance;
+        static bool isInitialized = false;
+
+        if (!isInitialized)
+        {
+            instance.loaded = AssetLoader::getInstance().loadFont(instance.font, "fonts/RobotoMono-Regular.ttf");
+            if (!instance.loaded)
+                std::cerr << "FontService: impossible de charger la police de l'UI\n";
+            isInitialized = true;
+        }
+        return instance;
+    }
+}
+
+const sf::Font &FontService::getFont()
+{
+    static bool isPrewarmed = false;
+    LoadedFont &loaded = getLoadedFont();
+    if (!isPrewarmed)
+    {
+        if (loaded.loaded)
+            prewarm(loaded.font);
+        isPrewarmed = true;
+    }
+    return loaded.font;
+}
+
+bool FontService::isLoaded()
+{
+    return getLoadedFont().loaded;
+}
+
+/**
+ * @brief Rastérise l'ASCII imprimable et le Latin-1 (accents) pour chaque taille de l'UI.
+ */
+void FontService::prewarm(const sf::Font &font)
+{
+    sf::Clock clock;
+    for (unsigned size : characterSizes)
+    {
+        for (sf::Uint32 c = 0x20; c <= 0x7E; ++c)
+            font.getGlyph(c, size, false);
+        for (sf::Uint32 c = 0xA0; c <= 0xFF; ++c)
+            font.getGlyph(c, size, false);
+    }
+    std::cout << "FontService: glyphes préchargés en " << clock.getElapsedTime().asMilliseconds() << " ms\n";
+}
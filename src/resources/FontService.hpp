@@ -0,0 +1,31 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+/**
+ * @brief Police partagée de l'interface (RobotoMono), chargée une seule fois.
+ *
+ * Au premier appel, les glyphes de toutes les tailles utilisées par l'UI sont rastérisés
+ * d'avance : l'apparition d'une notification ou d'un menu ne provoque plus de pic de frame.
+ * @note Le premier appel doit avoir lieu après la création de la fenêtre (contexte OpenGL).
+ */
+class FontService
+{
+public:
+    /**
+     * @brief Retourne la police de l'UI (chargée et préchauffée au premier appel)
+     */
+    static const sf::Font &getFont();
+
+    /**
+     * @brief Indique si la police a pu être chargée
+     */
+    static bool isLoaded();
+
+    /**
+     * @brief Tailles de caractères utilisées par l'UI, rastérisées au chargement
+     */
+    static constexpr unsigned characterSizes[] = {12, 14, 18, 20, 32, 38, 50, 60, 80};
+
+private:
+    static void prewarm(const sf::Font &font);
+};
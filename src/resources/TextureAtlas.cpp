@@ -0,0 +1,285 @@
+#include "TextureAtlas.hpp"
+#include "AssetLoader.hpp"
+#include "../profiling/TraceRecorder.hpp"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+/**
+ * @brief Retourne l'atlas par défaut du jeu, construit au premier appel.
+ * @note Doit être appelé après la création de la fenêtre (un contexte OpenGL est nécessaire),
+ * sauf en mode headless.
+ */
+TextureAtlas &TextureAtlas::getDefault()
+{
+    static TextureAtlas defaultAtlas;
+    static bool isLoaded = false;
+
+    if (!isLoaded)
+    {
+        if (!defaultAtlas.loadDirectory(defaultDirectory))
+        {
+            std::cerr << "Erreur : impossible de construire l'atlas depuis " << defaultDirectory << "\n";
+            // Atlas vide (seulement la région de secours) pour que le jeu puisse continuer
+            defaultAtlas.build({});
+        }
+        isLoaded = true;
+    }
+
+    return defaultAtlas;
+}
+
+/**
+ * @brief Lance en tâche de fond le décodage des images de l'atlas par défaut.
+ */
+void TextureAtlas::prefetchDefault()
+{
+    for (const auto &file : listImages(defaultDirectory))
+        AssetLoader::getInstance().requestImage(file);
+}
+
+bool &TextureAtlas::headlessFlag()
+{
+    static bool headless = false;
+    return headless;
+}
+
+void TextureAtlas::setHeadless(bool headless)
+{
+    headlessFlag() = headless;
+}
+
+bool TextureAtlas::isHeadless()
+{
+    return headlessFlag();
+}
+
+/**
+ * @brief Charge tous les PNG d'un dossier d'assets (récursivement) et construit l'atlas.
+ * @note Les images sont décodées en parallèle par l'AssetLoader ; ce thread ne fait qu'attendre
+ * les handles puis assembler et envoyer l'atlas au GPU.
+ *
+ * @param prefix Le dossier des images, relatif à src/assets
+ * @return true si l'atlas a été construit
+ */
+bool TextureAtlas::loadDirectory(const std::string &prefix)
+{
+    TRACE_SCOPE("atlas_load");
+    std::vector<std::string> files = listImages(prefix);
+    if (files.empty())
+        return false;
+
+    // Toutes les requêtes partent avant la première attente (déjà en cours si prefetchDefault a été appelé)
+    std::vector<AssetLoader::ImageHandle> handles;
+    handles.reserve(files.size());
+    for (const auto &file : files)
+        handles.push_back(AssetLoader::getInstance().requestImage(file));
+
+    std::vector<std::pair<std::string, std::shared_ptr<const sf::Image>>> images;
+    images.reserve(files.size());
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        std::shared_ptr<const sf::Image> image = handles[i].get();
+        if (!image)
+            continue;
+        images.emplace_back(files[i].substr(prefix.size()), std::move(image));
+    }
+
+    bool built = build(images);
+    // Les pixels vivent désormais dans l'atlas : inutile de garder les images décodées
+    AssetLoader::getInstance().releaseImages();
+    return built;
+}
+
+/**
+ * @brief Empaquette les images par étagères, de la plus haute à la plus basse.
+ *
+ * @param images Les images à empaqueter avec leur clé
+ * @return true si l'atlas a été construit
+ */
+bool TextureAtlas::build(const std::vector<std::pair<std::string, std::shared_ptr<const sf::Image>>> &images)
+{
+    TRACE_SCOPE("atlas_build");
+    // Région de secours (transparente) pour les images introuvables
+    sf::Image fallbackImage;
+    fallbackImage.create(32, 32, sf::Color::Transparent);
+
+    std::vector<std::pair<std::string, const sf::Image *>> entries;
+    entries.reserve(images.size() + 1);
+    entries.emplace_back(fallbackKey, &fallbackImage);
+    for (const auto &img : images)
+        entries.emplace_back(img.first, img.second.get());
+
+    std::stable_sort(entries.begin(), entries.end(), [](const auto &a, const auto &b)
+                     { return a.second->getSize().y > b.second->getSize().y; });
+
+    unsigned widest = 0;
+    for (const auto &e : entries)
+        widest = std::max(widest, e.second->getSize().x);
+
+    // Sans GPU, aucune limite de taille (et pas de contexte OpenGL à interroger)
+    const unsigned maxSize = isHeadless() ? std::numeric_limits<unsigned>::max() : sf::Texture::getMaximumSize();
+    // Dimensions en puissances de deux : coordonnées normalisées exactes (utilisé par le flash du SpriteBatch)
+    const unsigned atlasWidth = nextPowerOfTwo(std::max(atlasMinWidth, widest + 2 * padding));
+    if (atlasWidth > maxSize)
+    {
+        std::cerr << "TextureAtlas: une image dépasse la taille maximale de texture (" << maxSize << ")\n";
+        return false;
+    }
+
+    // Placement sur des étagères
+    std::vector<sf::Vector2u> placements(entries.size());
+    unsigned cursorX = 0;
+    unsigned cursorY = 0;
+    unsigned shelfHeight = 0;
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        sf::Vector2u size = entries[i].second->getSize();
+        unsigned cellW = size.x + 2 * padding;
+        unsigned cellH = size.y + 2 * padding;
+        if (cursorX + cellW > atlasWidth)
+        {
+            cursorY += shelfHeight;
+            cursorX = 0;
+            shelfHeight = 0;
+        }
+        placements[i] = sf::Vector2u(cursorX + padding, cursorY + padding);
+        cursorX += cellW;
+        shelfHeight = std::max(shelfHeight, cellH);
+    }
+    const unsigned atlasHeight = nextPowerOfTwo(cursorY + shelfHeight);
+    if (atlasHeight > maxSize)
+    {
+        std::cerr << "TextureAtlas: l'atlas (" << atlasWidth << "x" << atlasHeight << ") dépasse la taille maximale de texture\n";
+        return false;
+    }
+
+    sf::Image atlasImage;
+    atlasImage.create(atlasWidth, atlasHeight, sf::Color::Transparent);
+
+    regions.clear();
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const sf::Image &img = *entries[i].second;
+        sf::Vector2u size = img.getSize();
+        unsigned px = placements[i].x;
+        unsigned py = placements[i].y;
+        atlasImage.copy(img, px, py);
+
+        // Extrusion des bords dans la marge (évite que le filtrage ou l'arrondi échantillonne le voisin)
+        if (size.x > 0 && size.y > 0)
+        {
+            for (unsigned p = 1; p <= padding; ++p)
+            {
+                for (unsigned y = 0; y < size.y; ++y)
+                {
+                    atlasImage.setPixel(px - p, py + y, img.getPixel(0, y));
+                    atlasImage.setPixel(px + size.x - 1 + p, py + y, img.getPixel(size.x - 1, y));
+                }
+                for (unsigned x = 0; x < size.x; ++x)
+                {
+                    atlasImage.setPixel(px + x, py - p, img.getPixel(x, 0));
+                    atlasImage.setPixel(px + x, py + size.y - 1 + p, img.getPixel(x, size.y - 1));
+                }
+            }
+        }
+
+        regions[entries[i].first] = sf::IntRect(static_cast<int>(px), static_cast<int>(py), static_cast<int>(size.x), static_cast<int>(size.y));
+    }
+
+    auto newTexture = std::make_shared<sf::Texture>();
+    if (!isHeadless() && !newTexture->loadFromImage(atlasImage))
+    {
+        std::cerr << "TextureAtlas: échec de l'envoi de l'atlas au GPU\n";
+        return false;
+    }
+    texture = std::move(newTexture);
+
+    std::cout << "TextureAtlas: " << images.size() << " images empaquetées dans " << atlasWidth << "x" << atlasHeight << "\n";
+    return true;
+}
+
+/**
+ * @brief Retourne la région d'une image de l'atlas.
+ */
+AtlasRegion TextureAtlas::getRegion(const std::string &name) const
+{
+    auto it = regions.find(normalizeKey(name));
+    if (it != regions.end())
+        return {texture, it->second};
+
+    std::cerr << "TextureAtlas: image inconnue '" << name << "'\n";
+    auto fallback = regions.find(fallbackKey);
+    if (fallback != regions.end())
+        return {texture, fallback->second};
+    return {texture, sf::IntRect()};
+}
+
+bool TextureAtlas::hasRegion(const std::string &name) const
+{
+    return regions.find(normalizeKey(name)) != regions.end();
+}
+
+/**
+ * @brief Pave une zone avec une région de l'atlas, en découpant la dernière tuile de chaque ligne/colonne.
+ */
+void TextureAtlas::appendTiledQuads(sf::VertexArray &vertices, const sf::FloatRect &area, const sf::IntRect &region, const sf::Color &color)
+{
+    if (region.width <= 0 || region.height <= 0 || area.width <= 0.f || area.height <= 0.f)
+        return;
+
+    const float tileW = static_cast<float>(region.width);
+    const float tileH = static_cast<float>(region.height);
+    const float right = area.left + area.width;
+    const float bottom = area.top + area.height;
+    const float u0 = static_cast<float>(region.left);
+    const float v0 = static_cast<float>(region.top);
+
+    for (float y = area.top; y < bottom; y += tileH)
+    {
+        float h = std::min(tileH, bottom - y);
+        for (float x = area.left; x < right; x += tileW)
+        {
+            float w = std::min(tileW, right - x);
+            vertices.append(sf::Vertex(sf::Vector2f(x, y), color, sf::Vector2f(u0, v0)));
+            vertices.append(sf::Vertex(sf::Vector2f(x + w, y), color, sf::Vector2f(u0 + w, v0)));
+            vertices.append(sf::Vertex(sf::Vector2f(x + w, y + h), color, sf::Vector2f(u0 + w, v0 + h)));
+            vertices.append(sf::Vertex(sf::Vector2f(x, y + h), color, sf::Vector2f(u0, v0 + h)));
+        }
+    }
+}
+
+/**
+ * @brief Liste les PNG d'un dossier d'assets et de ses sous-dossiers, triés pour que l'atlas soit identique d'un lancement à l'autre.
+ */
+std::vector<std::string> TextureAtlas::listImages(const std::string &prefix)
+{
+    const std::string extension = ".png";
+    std::vector<std::string> files;
+    for (auto &id : AssetLoader::getInstance().listAssets(prefix))
+    {
+        if (id.size() > extension.size() && id.compare(id.size() - extension.size(), extension.size(), extension) == 0)
+            files.push_back(std::move(id));
+    }
+    return files;
+}
+
+unsigned TextureAtlas::nextPowerOfTwo(unsigned value)
+{
+    unsigned result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+/**
+ * @brief Ramène un chemin d'image à sa clé dans l'atlas ("assets/images/items/a.png" -> "items/a.png")
+ */
+std::string TextureAtlas::normalizeKey(const std::string &name)
+{
+    const std::string marker = "images/";
+    size_t pos = name.rfind(marker);
+    if (pos == std::string::npos)
+        return name;
+    return name.substr(pos + marker.size());
+}
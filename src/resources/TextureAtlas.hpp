@@ -0,0 +1,103 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Sous-rectangle d'une texture partagée (typiquement une entrée de l'atlas)
+ */
+struct AtlasRegion
+{
+    std::shared_ptr<sf::Texture> texture;
+    sf::IntRect rect;
+};
+
+/**
+ * @brief Atlas de textures : regroupe toutes les images du jeu dans une seule texture
+ * afin que les sprites puissent être dessinés sans changer de texture entre deux draws.
+ *
+ * Les images sont empaquetées par étagères (shelf packing) au démarrage, avec une marge
+ * dont les pixels reprennent le bord de chaque image pour éviter les coutures.
+ */
+class TextureAtlas
+{
+public:
+    TextureAtlas() = default;
+
+    /**
+     * @brief Atlas par défaut, construit au premier appel à partir de src/assets/images
+     */
+    static TextureAtlas &getDefault();
+
+    /**
+     * @brief Lance le décodage des images de l'atlas par défaut sur les threads de l'AssetLoader.
+     * À appeler le plus tôt possible (avant la création de la fenêtre) pour que getDefault()
+     * n'ait plus qu'à assembler et envoyer l'atlas au GPU.
+     */
+    static void prefetchDefault();
+
+    /**
+     * @brief Mode sans GPU (simulation headless) : les régions sont calculées mais l'atlas
+     * n'est pas envoyé au GPU ; les sprites référencent une texture vide.
+     * @note À appeler avant le premier getDefault()
+     */
+    static void setHeadless(bool headless);
+    static bool isHeadless();
+
+    /**
+     * @brief Charge tous les PNG d'un dossier d'assets (archive ou disque) puis construit l'atlas
+     * @param prefix Le dossier des images, relatif à src/assets ("images/") ; les clés sont relatives à ce dossier
+     * @return true si l'atlas a pu être construit
+     */
+    bool loadDirectory(const std::string &prefix);
+
+    /**
+     * @brief Construit l'atlas à partir d'images déjà décodées
+     * @param images Paires (clé, image) à empaqueter
+     * @return true si l'atlas tient dans la taille maximale de texture du GPU
+     */
+    bool build(const std::vector<std::pair<std::string, std::shared_ptr<const sf::Image>>> &images);
+
+    /**
+     * @brief Retourne la région associée à une image
+     * @param name Chemin de l'image relatif au dossier images ("items/healthPotion.png").
+     *             Tout préfixe se terminant par "images/" est ignoré.
+     * @return La région, ou une région vide de 32x32 si l'image est inconnue
+     */
+    AtlasRegion getRegion(const std::string &name) const;
+
+    bool hasRegion(const std::string &name) const;
+
+    std::shared_ptr<sf::Texture> getTexture() const { return texture; }
+
+    /**
+     * @brief Ajoute à un tableau de quads la zone demandée, pavée avec la région
+     * (équivalent d'une texture répétée, qui n'est pas possible sur un sous-rectangle d'atlas)
+     *
+     * @param vertices Le tableau de sommets (type sf::Quads)
+     * @param area La zone à remplir, en coordonnées monde (1 pixel de texture = 1 unité)
+     * @param region Le rectangle de la texture à répéter
+     * @param color Couleur appliquée aux sommets
+     */
+    static void appendTiledQuads(sf::VertexArray &vertices, const sf::FloatRect &area, const sf::IntRect &region, const sf::Color &color = sf::Color::White);
+
+private:
+    std::shared_ptr<sf::Texture> texture;
+    std::unordered_map<std::string, sf::IntRect> regions;
+
+    static constexpr unsigned atlasMinWidth = 1024;
+    static constexpr unsigned padding = 2;
+    static constexpr const char *fallbackKey = "__fallback";
+
+    static constexpr const char *defaultDirectory = "images/";
+
+    static bool &headlessFlag();
+    static std::string normalizeKey(const std::string &name);
+    static unsigned nextPowerOfTwo(unsigned value);
+
+    // Liste triée des PNG d'un dossier d'assets (récursivement)
+    static std::vector<std::string> listImages(const std::string &prefix);
+};
@@ -0,0 +1,83 @@
+#pragma once
+#include <algorithm>
+#include <iostream>
+#include <streambuf>
+#include <vector>
+#include "../resources/TextureAtlas.hpp"
+
+/**
+ * @brief Briques communes aux outils sans fenêtre (bench, stress, replay) : démarrage sans GPU,
+ * journaux du jeu mis en sourdine pendant les mesures et résumé des temps par tick.
+ */
+namespace ToolCommon
+{
+    /**
+     * @brief Pas de GPU : l'atlas est construit sans texture (à appeler avant tout chargement)
+     */
+    inline void startHeadless()
+    {
+        TextureAtlas::setHeadless(true);
+    }
+
+    /**
+     * @brief Rend std::cout et std::cerr muets jusqu'à restore() ou la fin de la portée : les journaux
+     * du jeu (génération de niveau, ExitBlock) sont formatés mais pas affichés
+     */
+    class SilenceGuard
+    {
+    public:
+        SilenceGuard()
+            : previousOut(std::cout.rdbuf(&nullBuffer)), previousErr(std::cerr.rdbuf(&nullBuffer))
+        {
+        }
+        ~SilenceGuard() { restore(); }
+
+        SilenceGuard(const SilenceGuard &) = delete;
+        SilenceGuard &operator=(const SilenceGuard &) = delete;
+
+        void restore()
+        {
+            if (!previousOut)
+                return;
+            std::cout.rdbuf(previousOut);
+            std::cerr.rdbuf(previousErr);
+            previousOut = previousErr = nullptr;
+        }
+
+    private:
+        struct NullBuffer : std::streambuf
+        {
+            int overflow(int c) override { return c; }
+        };
+
+        NullBuffer nullBuffer;
+        std::streambuf *previousOut;
+        std::streambuf *previousErr;
+    };
+
+    struct TickSummary
+    {
+        double meanMs = 0.0;
+        double p50Ms = 0.0;
+        double p99Ms = 0.0;
+        double maxMs = 0.0;
+    };
+
+    /**
+     * @brief Moyenne, médiane, 99e centile et maximum des temps par tick (trie tickMs ; zéros si vide)
+     */
+    inline TickSummary summarizeTicks(std::vector<double> &tickMs)
+    {
+        TickSummary summary;
+        if (tickMs.empty())
+            return summary;
+        for (double ms : tickMs)
+            summary.meanMs += ms;
+        summary.meanMs /= static_cast<double>(tickMs.size());
+        std::sort(tickMs.begin(), tickMs.end());
+        summary.p50Ms = tickMs[tickMs.size() / 2];
+        summary.p99Ms = tickMs[std::min(tickMs.size() - 1, tickMs.size() * 99 / 100)];
+        summary.maxMs = tickMs.back();
+        return summary;
+    }
+}
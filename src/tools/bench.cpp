@@ -0,0 +1,338 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../blocks/ExitBlock.hpp"
+#include "../environnement/Ground.hpp"
+#include "../environnement/ModelGenerator.hpp"
+#include "../factories/CharacterFactory.hpp"
+#include "../objects/Chest.hpp"
+#include "../resources/TextureAtlas.hpp"
+#include "ToolCommon.hpp"
+
+/**
+ * @brief Micro-benchmarks des chemins chauds du cœur de jeu (sans fenêtre ni GPU).
+ *
+ * Usage : bench [--filter <texte>] [--out <resultats.csv>] [--baseline <reference.csv>] [--threshold <pourcent>]
+ *
+ * Les résultats sont écrits en CSV (benchmark,param,iterations,ns_per_op,min_ns_per_op) sur la
+ * sortie standard et dans --out. Avec --baseline, chaque mesure est comparée à la référence :
+ * le code de retour vaut 2 si une mesure est plus lente que la référence de plus de --threshold %.
+ */
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using Grounds = std::vector<std::unique_ptr<Ground>>;
+
+    struct Result
+    {
+        std::string name;
+        long param = 0;
+        std::size_t iterations = 0;
+        double nsPerOp = 0.0;    // médiane des échantillons
+        double minNsPerOp = 0.0; // meilleur échantillon
+    };
+
+    // Empêche le compilateur de supprimer un calcul dont le résultat n'est pas utilisé
+    volatile std::size_t sink = 0;
+
+    /**
+     * @brief Mesure une opération : calibre le nombre d'itérations pour ~10 ms par échantillon,
+     * puis garde la médiane de plusieurs échantillons
+     */
+    Result measure(const std::string &name, long param, const std::function<void()> &op)
+    {
+        constexpr int samples = 7;
+        constexpr double targetNs = 10.0e6;
+
+        auto run = [&op](std::size_t iterations)
+        {
+            auto start = Clock::now();
+            for (std::size_t i = 0; i < iterations; ++i)
+                op();
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        };
+
+        std::size_t iterations = 1;
+        double elapsed = run(iterations);
+        while (elapsed < targetNs && iterations < (std::size_t(1) << 30))
+        {
+            iterations *= 2;
+            elapsed = run(iterations);
+        }
+
+        std::vector<double> perOp(samples);
+        for (double &value : perOp)
+            value = run(iterations) / static_cast<double>(iterations);
+        std::sort(perOp.begin(), perOp.end());
+
+        return {name, param, iterations, perOp[samples / 2], perOp.front()};
+    }
+
+    /**
+     * @brief Sols alignés en grille (pas de 256 unités, comme les cases du labyrinthe), à partir de l'origine
+     */
+    Grounds makeGrounds(int count)
+    {
+        Grounds grounds;
+        grounds.reserve(count);
+        const int columns = 32;
+        for (int i = 0; i < count; ++i)
+            grounds.push_back(std::make_unique<Ground>(256.f * (i % columns), 256.f * (i / columns) + 240.f, 256.f, 16.f));
+        return grounds;
+    }
+
+    // Expose la construction des sols d'un bloc (protégée dans ExitBlock)
+    struct BenchExitBlock : ExitBlock
+    {
+        using ExitBlock::ExitBlock;
+        using ExitBlock::buildGrounds;
+    };
+
+    void benchCheckAllCollisions(std::vector<Result> &results)
+    {
+        auto candle = CharacterFactory::createCandle({0.f, 0.f});
+        for (int count : {16, 64, 256, 1024})
+        {
+            Grounds grounds = makeGrounds(count);
+            results.push_back(measure("GameCharacter::checkAllCollisions", count, [&]
+                                      {
+                // Posé sur le premier sol : une collision résolue par appel
+                candle->setPosition(64.f, 220.f);
+                candle->collisionsToZero();
+                candle->checkAllCollisions(grounds);
+                sink = sink + candle->isOnGround(); }));
+        }
+    }
+
+    void benchHasLineOfSight(std::vector<Result> &results)
+    {
+        // Rayon dégagé (au-dessus de tous les sols) : pire cas, chaque échantillon teste chaque sol
+        Grounds grounds = makeGrounds(512);
+        for (int distance : {128, 512, 2048, 8192})
+        {
+            const sf::Vector2f from(0.f, -512.f);
+            const sf::Vector2f to(static_cast<float>(distance), -512.f);
+            results.push_back(measure("GameCharacter::hasLineOfSight", distance, [&]
+                                      { sink = sink + GameCharacter::hasLineOfSight(from, to, grounds); }));
+        }
+    }
+
+    void benchResolveCollisionWithCharacter(std::vector<Result> &results)
+    {
+        Grounds grounds = makeGrounds(512);
+        for (int count : {2, 8, 32, 128})
+        {
+            std::vector<std::unique_ptr<Candle>> candles;
+            for (int i = 0; i < count; ++i)
+            {
+                candles.push_back(CharacterFactory::createCandle({0.f, 0.f}));
+                candles.back()->setForce(10 + i % 3);
+            }
+
+            // Une passe = toutes les paires, comme la boucle de jeu ; personnages regroupés pour se chevaucher
+            results.push_back(measure("GameCharacter::resolveCollisionWithCharacter", count, [&]
+                                      {
+                for (int i = 0; i < count; ++i)
+                    candles[i]->setPosition(8.f * (i % 8), -400.f - 8.f * (i / 8));
+                for (int i = 0; i < count; ++i)
+                    for (int j = i + 1; j < count; ++j)
+                        candles[i]->resolveCollisionWithCharacter(*candles[j], grounds);
+                sink = sink + static_cast<std::size_t>(candles.back()->getPosition().x); }));
+        }
+    }
+
+    void benchModelGenerator(std::vector<Result> &results)
+    {
+        for (int columns : {7, 14, 28, 56})
+        {
+            const int rows = columns * 4 / 7;
+            results.push_back(measure("ModelGenerator", columns * rows, [&]
+                                      {
+                ModelGenerator generator(columns, rows);
+                sink = sink + generator.getGrid().size();
+                // ModelGenerator ne libère pas ses nœuds
+                for (Node *node : generator.getGrid())
+                    delete node; }));
+        }
+    }
+
+    void benchBuildGrounds(std::vector<Result> &results)
+    {
+        const sf::Vector2u areaSize(256 * ExitBlock::GRID_COLS, 256 * ExitBlock::GRID_ROWS);
+        BenchExitBlock block(LEFT_EXIT, 0, 0, areaSize);
+        for (BlockType mask : {LEFT_EXIT, LEFT_RIGHT_EXIT, LEFT_TOP_RIGHT_EXIT, LEFT_TOP_RIGHT_BOTTOM_EXIT})
+        {
+            results.push_back(measure("ExitBlock::buildGrounds", mask, [&]
+                                      { sink = sink + block.buildGrounds(mask, 3, 2).size(); }));
+        }
+    }
+
+    void benchGenerateLoot(std::vector<Result> &results)
+    {
+        TextureAtlas &atlas = TextureAtlas::getDefault();
+        Chest chest({0.f, 0.f}, atlas.getRegion("chest.png"), atlas.getRegion("chestOpened.png"));
+        for (int level : {1, 11, 41})
+        {
+            results.push_back(measure("Chest::generateLoot", level, [&]
+                                      { sink = sink + chest.generateLoot(level).size(); }));
+        }
+    }
+
+    void benchAddItem(std::vector<Result> &results)
+    {
+        // Param : nombre de piles d'autres types placées avant celle de l'item ajouté
+        for (int occupied : {0, 1, 2, 3})
+        {
+            auto candle = CharacterFactory::createCandle({0.f, 0.f});
+            if (occupied > 0)
+                candle->addItem(std::make_unique<ManaPotion>(10));
+            if (occupied > 1)
+                candle->addItem(std::make_unique<HealthAmulet>(10));
+            if (occupied > 2)
+                candle->addItem(std::make_unique<DamageAmulet>(1));
+
+            // Ajout puis retrait : l'inventaire reste identique d'une itération à l'autre
+            results.push_back(measure("GameCharacter::addItem", occupied, [&]
+                                      {
+                sink = sink + candle->addItem(std::make_unique<HealthPotion>(20));
+                candle->removeItem(occupied); }));
+        }
+    }
+
+    std::string keyOf(const std::string &name, long param)
+    {
+        return name + "/" + std::to_string(param);
+    }
+
+    void writeCsv(std::ostream &out, const std::vector<Result> &results)
+    {
+        out << "benchmark,param,iterations,ns_per_op,min_ns_per_op\n";
+        for (const Result &r : results)
+            out << r.name << ',' << r.param << ',' << r.iterations << ',' << r.nsPerOp << ',' << r.minNsPerOp << '\n';
+    }
+
+    /**
+     * @brief Lit un CSV produit par writeCsv : ns_per_op par "benchmark/param"
+     */
+    bool readBaseline(const std::string &path, std::map<std::string, double> &baseline)
+    {
+        std::ifstream in(path);
+        if (!in)
+            return false;
+
+        std::string line;
+        std::getline(in, line); // en-tête
+        while (std::getline(in, line))
+        {
+            std::stringstream ss(line);
+            std::string name, param, iterations, nsPerOp;
+            if (std::getline(ss, name, ',') && std::getline(ss, param, ',') && std::getline(ss, iterations, ',') && std::getline(ss, nsPerOp, ','))
+                baseline[name + "/" + param] = std::atof(nsPerOp.c_str());
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string filter;
+    std::string outPath;
+    std::string baselinePath;
+    double threshold = 15.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--filter") && hasValue)
+            filter = argv[++i];
+        else if (!std::strcmp(argv[i], "--out") && hasValue)
+            outPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--baseline") && hasValue)
+            baselinePath = argv[++i];
+        else if (!std::strcmp(argv[i], "--threshold") && hasValue)
+            threshold = std::atof(argv[++i]);
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--filter <text>] [--out <results.csv>] [--baseline <baseline.csv>] [--threshold <percent>]\n";
+            return 1;
+        }
+    }
+
+    ToolCommon::startHeadless();
+
+    // Les journaux des fonctions mesurées (ExitBlock) sont formatés mais pas affichés
+    ToolCommon::SilenceGuard silence;
+
+    const std::vector<std::pair<std::string, void (*)(std::vector<Result> &)>> suites = {
+        {"GameCharacter::checkAllCollisions", benchCheckAllCollisions},
+        {"GameCharacter::hasLineOfSight", benchHasLineOfSight},
+        {"GameCharacter::resolveCollisionWithCharacter", benchResolveCollisionWithCharacter},
+        {"ModelGenerator", benchModelGenerator},
+        {"ExitBlock::buildGrounds", benchBuildGrounds},
+        {"Chest::generateLoot", benchGenerateLoot},
+        {"GameCharacter::addItem", benchAddItem},
+    };
+
+    std::vector<Result> results;
+    for (const auto &suite : suites)
+    {
+        if (filter.empty() || suite.first.find(filter) != std::string::npos)
+            suite.second(results);
+    }
+
+    silence.restore();
+
+    writeCsv(std::cout, results);
+    if (!outPath.empty())
+    {
+        std::ofstream out(outPath);
+        if (!out)
+        {
+            std::cerr << "bench: cannot write " << outPath << "\n";
+            return 1;
+        }
+        writeCsv(out, results);
+    }
+
+    if (baselinePath.empty())
+        return 0;
+
+    std::map<std::string, double> baseline;
+    if (!readBaseline(baselinePath, baseline))
+    {
+        std::cerr << "bench: cannot read baseline " << baselinePath << "\n";
+        return 1;
+    }
+
+    int regressions = 0;
+    for (const Result &r : results)
+    {
+        auto it = baseline.find(keyOf(r.name, r.param));
+        if (it == baseline.end() || it->second <= 0.0)
+        {
+            std::cerr << "bench: " << keyOf(r.name, r.param) << " not in baseline\n";
+            continue;
+        }
+        const double change = (r.nsPerOp / it->second - 1.0) * 100.0;
+        const bool regressed = change > threshold;
+        regressions += regressed;
+        std::cerr << (regressed ? "REGRESSION " : "ok         ") << keyOf(r.name, r.param) << ": "
+                  << it->second << " -> " << r.nsPerOp << " ns/op (" << (change >= 0 ? "+" : "") << change << "%)\n";
+    }
+
+    if (regressions > 0)
+    {
+        std::cerr << "bench: " << regressions << " regression(s) above " << threshold << "%\n";
+        return 2;
+    }
+    return 0;
+}
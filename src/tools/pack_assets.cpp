@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include "../resources/AssetArchiveFormat.hpp"
+
+/**
+ * @brief Outil de build : empaquette un dossier d'assets dans une archive unique indexée.
+ *
+ * Usage : pack_assets <dossier_assets> <archive_sortie>
+ */
+int main(int argc, char **argv)
+{
+    namespace fs = std::filesystem;
+    using namespace AssetArchiveFormat;
+
+    if (argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <assets_dir> <output.pak>\n";
+        return 1;
+    }
+
+    const fs::path root = argv[1];
+    std::error_code ec;
+    if (!fs::is_directory(root, ec))
+    {
+        std::cerr << "pack_assets: " << root << " is not a directory\n";
+        return 1;
+    }
+
+    struct Source
+    {
+        std::string name;
+        std::vector<char> bytes;
+        std::uint64_t hash;
+    };
+    std::vector<Source> sources;
+
+    for (const auto &entry : fs::recursive_directory_iterator(root))
+    {
+        if (!entry.is_regular_file())
+            continue;
+        std::ifstream in(entry.path(), std::ios::binary);
+        if (!in)
+        {
+            std::cerr << "pack_assets: cannot read " << entry.path() << "\n";
+            return 1;
+        }
+        Source s;
+        s.name = entry.path().lexically_relative(root).generic_string();
+        s.bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        s.hash = hashName(s.name);
+        sources.push_back(std::move(s));
+    }
+
+    std::sort(sources.begin(), sources.end(), [](const Source &a, const Source &b)
+              { return a.hash != b.hash ? a.hash < b.hash : a.name < b.name; });
+
+    // Calcul des offsets : en-tête, index, noms, puis données alignées
+    std::uint64_t offset = sizeof(Header) + sources.size() * sizeof(IndexEntry);
+    std::vector<IndexEntry> index(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        index[i].hash = sources[i].hash;
+        index[i].nameOffset = offset;
+        index[i].nameLength = static_cast<std::uint32_t>(sources[i].name.size());
+        index[i].reserved = 0;
+        offset += sources[i].name.size();
+    }
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        offset = (offset + dataAlignment - 1) / dataAlignment * dataAlignment;
+        index[i].dataOffset = offset;
+        index[i].dataSize = sources[i].bytes.size();
+        offset += sources[i].bytes.size();
+    }
+
+    std::ofstream out(argv[2], std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        std::cerr << "pack_assets: cannot write " << argv[2] << "\n";
+        return 1;
+    }
+
+    Header header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.entryCount = static_cast<std::uint32_t>(sources.size());
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(IndexEntry)));
+    for (const auto &s : sources)
+        out.write(s.name.data(), static_cast<std::streamsize>(s.name.size()));
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        std::uint64_t pos = static_cast<std::uint64_t>(out.tellp());
+        if (pos < index[i].dataOffset)
+        {
+            std::vector<char> zeros(index[i].dataOffset - pos, 0);
+            out.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+        }
+        out.write(sources[i].bytes.data(), static_cast<std::streamsize>(sources[i].bytes.size()));
+    }
+
+    if (!out)
+    {
+        std::cerr << "pack_assets: write failed for " << argv[2] << "\n";
+        return 1;
+    }
+
+    std::cout << "pack_assets: " << sources.size() << " files, " << offset << " bytes -> " << argv[2] << "\n";
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../core/GameRandom.hpp"
+#include "../input/InputRecording.hpp"
+#include "../levels/GameSession.hpp"
+#include "ToolCommon.hpp"
+
+/**
+ * @brief Rejoue sans fenêtre des parties enregistrées (main --record partie.rec) avec la vraie simulation
+ * (GameSession), et vérifie qu'elles aboutissent au même état.
+ *
+ * Usage : replay <partie.rec>... [--repeat <N>] [--out <resultats.csv>]
+ *
+ * Chaque enregistrement donne une ligne CSV : temps par tick (moyenne, p50, p99, max) du meilleur des
+ * N passages et empreinte de l'état final. Le code de retour vaut 2 si une empreinte diffère de celle
+ * enregistrée : une optimisation doit garder les parties identiques au bit près.
+ */
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Report
+    {
+        std::string path;
+        std::uint32_t ticks = 0;
+        double totalMs = 0.0;
+        ToolCommon::TickSummary timing;
+        std::uint64_t stateHash = 0;
+        bool matches = true;
+    };
+
+    /**
+     * @brief Un passage complet : même graine, même zone, mêmes entrées, même pas que la partie enregistrée
+     */
+    Report run(const InputRecording &recording, const std::vector<InputState> &inputs)
+    {
+        // Les journaux de la génération de niveau (ExitBlock) ne sont pas affichés
+        ToolCommon::SilenceGuard silence;
+
+        std::vector<double> tickMs;
+        tickMs.reserve(inputs.size());
+
+        GameRandom::seed(recording.seed);
+        const auto sessionStart = Clock::now();
+        GameSession session(recording.areaSize);
+        for (const InputState &input : inputs)
+        {
+            const auto start = Clock::now();
+            session.tick(input, recording.tickSeconds);
+            tickMs.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+
+        Report report;
+        report.totalMs = std::chrono::duration<double, std::milli>(Clock::now() - sessionStart).count();
+        report.stateHash = session.computeStateHash();
+
+        silence.restore();
+
+        report.ticks = static_cast<std::uint32_t>(inputs.size());
+        report.timing = ToolCommon::summarizeTicks(tickMs);
+        return report;
+    }
+
+    void writeHeader(std::ostream &out)
+    {
+        out << "recording,ticks,total_ms,mean_ms,p50_ms,p99_ms,max_ms,state_hash,matches\n";
+    }
+
+    void writeReport(std::ostream &out, const Report &r)
+    {
+        char hash[17];
+        std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(r.stateHash));
+        out << r.path << ',' << r.ticks << ',' << r.totalMs << ',' << r.timing.meanMs << ',' << r.timing.p50Ms << ','
+            << r.timing.p99Ms << ',' << r.timing.maxMs << ',' << hash << ',' << (r.matches ? "yes" : "no") << '\n';
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> paths;
+    int repeat = 1;
+    std::string outPath;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (!std::strcmp(argv[i], "--repeat") && hasValue)
+            repeat = std::max(1, std::atoi(argv[++i]));
+        else if (!std::strcmp(argv[i], "--out") && hasValue)
+            outPath = argv[++i];
+        else if (argv[i][0] != '-')
+            paths.push_back(argv[i]);
+        else
+        {
+            paths.clear();
+            break;
+        }
+    }
+    if (paths.empty())
+    {
+        std::cerr << "Usage: " << argv[0] << " <session.rec>... [--repeat <N>] [--out <results.csv>]\n";
+        return 1;
+    }
+
+    std::ofstream out;
+    if (!outPath.empty())
+    {
+        out.open(outPath);
+        if (!out)
+        {
+            std::cerr << "replay: cannot write " << outPath << "\n";
+            return 1;
+        }
+        writeHeader(out);
+    }
+
+    ToolCommon::startHeadless();
+
+    int failures = 0;
+
+    writeHeader(std::cout);
+    for (const auto &path : paths)
+    {
+        InputRecording recording;
+        if (!recording.load(path))
+        {
+            ++failures;
+            continue;
+        }
+        std::vector<InputState> inputs;
+        recording.expand(inputs);
+
+        // Meilleur des passages pour le temps ; tous doivent aboutir au même état
+        Report best;
+        for (int pass = 0; pass < repeat; ++pass)
+        {
+            Report report = run(recording, inputs);
+            if (pass > 0 && report.stateHash != best.stateHash)
+            {
+                std::cerr << "replay: " << path << " is not deterministic between passes\n";
+                ++failures;
+            }
+            if (pass == 0 || report.totalMs < best.totalMs)
+                best = report;
+        }
+        best.path = path;
+        best.matches = recording.finalStateHash == 0 || best.stateHash == recording.finalStateHash;
+
+        writeReport(std::cout, best);
+        if (out.is_open())
+            writeReport(out, best);
+
+        if (!best.matches)
+        {
+            std::cerr << "replay: " << path << " ended in a different state than recorded\n";
+            ++failures;
+        }
+    }
+    return failures > 0 ? 2 : 0;
+}
@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../core/GameRandom.hpp"
+#include "../events/CommandBuffer.hpp"
+#include "../events/GameplayEventBus.hpp"
+#include "../events/GameplayTelemetry.hpp"
+#include "../factories/CharacterFactory.hpp"
+#include "../levels/GameLevel.hpp"
+#include "../profiling/AllocationTracker.hpp"
+#include "../rendering/Renderer.hpp"
+#include "ToolCommon.hpp"
+
+/**
+ * @brief Scénarios de charge sans fenêtre : labyrinthe de W x H cellules, N chandelles et un joueur scripté,
+ * simulés pendant K ticks avec la partie simulation de la boucle de jeu : commandes et GameLevel::step,
+ * distribution du bus d'événements (abonné télémétrie), puis instantané de rendu (cellules explorées,
+ * culling, soumission des sprites, barres de vie, HUD).
+ *
+ * Usage : stress [--size <W>x<H>]... [--npcs <N>]... [--ticks <K>] [--warmup <ticks>] [--out <resultats.csv>] [--max-allocs <N>]
+ *
+ * Chaque combinaison (W, H, N) donne une ligne CSV : temps par tick (moyenne, p50, p99, max) et
+ * allocations par tick hors échauffement (AllocationTracker, compilé avec GAME_PROFILING).
+ * Sans --size ni --npcs, un balayage par défaut est exécuté.
+ *
+ * --max-allocs vérifie le régime établi : le code de retour vaut 2 si un scénario alloue plus
+ * de N fois sur l'ensemble de ses ticks mesurés (--max-allocs 0 : aucune allocation par tick).
+ * @note Seul le chemin ci-dessus est vérifié. Ce qui demande une fenêtre ou vit dans l'exécutable
+ * du jeu n'est pas couvert : lecture des événements (InputSystem), textes des notifications et
+ * abonnés interface et caméra, frames en pause, dessin du thread de rendu.
+ */
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Scenario
+    {
+        int columns = GameLevel::mazeColumns;
+        int rows = GameLevel::mazeRows;
+        int npcs = 0;
+    };
+
+    struct Report
+    {
+        Scenario scenario;
+        int ticks = 0;
+        ToolCommon::TickSummary timing;
+        std::uint64_t allocations = 0; // hors ticks d'échauffement
+        double allocationsPerTick = 0.0;
+        double bytesPerTick = 0.0;
+        std::size_t npcsAlive = 0;
+    };
+
+    // Taille d'une fenêtre 1080p : cellules de la même taille qu'en jeu
+    const sf::Vector2u areaSize(1920, 1080);
+    constexpr float tickSeconds = 1.f / 60.f;
+
+    /**
+     * @brief Joueur scripté : va-et-vient toutes les 2 s, saute et attaque à intervalles fixes
+     */
+    void drivePlayer(Player &player, int tick, CommandBuffer &commands)
+    {
+        const int direction = (tick / 120) % 2 == 0 ? 1 : -1;
+        if (player.isOnGround() || player.isOnLadder())
+            commands.push(Command::move(player, sf::Vector2f(direction * player.getSpeed() * tickSeconds, 0.f)));
+        if (tick % 90 == 0 && player.isOnGround())
+            commands.push(Command::jump(player));
+        if (tick % 30 == 0)
+            commands.push(Command::attack(player, direction > 0 ? Direction::Right : Direction::Left));
+    }
+
+    Report run(const Scenario &scenario, int ticks, int warmupTicks)
+    {
+        // Les journaux de la génération de niveau (ExitBlock) ne sont pas affichés
+        ToolCommon::SilenceGuard silence;
+
+        // Graine fixe : le même labyrinthe d'une exécution à l'autre
+        GameRandom::seed(1);
+        GameLevel level = GameLevel::generate(areaSize, scenario.columns, scenario.rows);
+
+        // N exactement : les apparitions aléatoires des blocs sont remplacées par les chandelles du scénario
+        level.spawnedCharacters.clear();
+        const int cells = scenario.columns * scenario.rows;
+        for (int i = 0; i < scenario.npcs; ++i)
+        {
+            const int cell = i % cells;
+            const float x = (cell % scenario.columns + 0.5f) * level.cellSize.x + 8.f * (i / cells);
+            const float y = (cell / scenario.columns + 0.5f) * level.cellSize.y;
+            level.spawnedCharacters.push_back(CharacterFactory::createCandle({x, y}));
+        }
+
+        auto player = CharacterFactory::createPlayer(areaSize);
+        player->setPosition(20.f, level.cellSize.y * (scenario.rows - 0.5f));
+
+        silence.restore();
+
+        std::vector<GameCharacter *> characters;
+        characters.push_back(player.get());
+        for (auto &character : level.spawnedCharacters)
+            characters.push_back(character.get());
+
+        CommandBuffer commands;
+        NullRenderer renderer;
+        std::vector<GameCharacter *> visibleCharacters;
+        sf::View view(sf::Vector2f(0.f, 0.f), sf::Vector2f(768.f, 432.f));
+
+        std::vector<double> tickMs;
+        tickMs.reserve(ticks);
+        AllocationTracker::Counts before;
+
+        // Les premiers ticks dimensionnent les tampons réutilisés : ni mesurés ni comptés
+        for (int tick = -warmupTicks; tick < ticks; ++tick)
+        {
+            if (tick == 0)
+                before = AllocationTracker::getTotal();
+            const auto start = Clock::now();
+
+            drivePlayer(*player, tick, commands);
+            level.step(tickSeconds, *player, characters, commands);
+            GameplayEventBus::getInstance().dispatch();
+
+            // Instantané de rendu, comme la boucle de jeu : culling puis soumission des sprites
+            view.setCenter(player->getPosition());
+            RenderSnapshot &frame = renderer.beginSnapshot();
+            frame.explored = level.explored;
+            frame.sprites.clear();
+            frame.culling.reset();
+            frame.healthBars.clear();
+            const sf::FloatRect viewRect = VisibilityGrid::getViewRect(view);
+            level.visibilityGrid.submitObjects(frame.sprites, viewRect, frame.culling);
+            VisibilityGrid::collectVisibleCharacters(viewRect, characters, visibleCharacters, frame.culling);
+            for (auto *character : visibleCharacters)
+            {
+                character->submit(frame.sprites);
+                if (character != player.get())
+                    frame.healthBars.push_back({character->getPosition(), character->getBounds().width, character->getHp(), character->getMaxHp()});
+            }
+            frame.hud = {player->getHp(), player->getMaxHp(), player->getMana(), player->getMaxMana(),
+                         player->getEndurance(), player->getMaxEndurance(), 1};
+            renderer.publish();
+
+            if (tick >= 0)
+                tickMs.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+        const AllocationTracker::Counts after = AllocationTracker::getTotal();
+
+        Report report;
+        report.scenario = scenario;
+        report.ticks = ticks;
+        report.allocations = after.allocations - before.allocations;
+        report.allocationsPerTick = static_cast<double>(report.allocations) / ticks;
+        report.bytesPerTick = static_cast<double>(after.bytes - before.bytes) / ticks;
+        report.npcsAlive = characters.size() - 1;
+        report.timing = ToolCommon::summarizeTicks(tickMs);
+        return report;
+    }
+
+    void writeHeader(std::ostream &out)
+    {
+        out << "columns,rows,npcs,ticks,mean_ms,p50_ms,p99_ms,max_ms,allocs_per_tick,bytes_per_tick,npcs_alive\n";
+    }
+
+    void writeReport(std::ostream &out, const Report &r)
+    {
+        out << r.scenario.columns << ',' << r.scenario.rows << ',' << r.scenario.npcs << ',' << r.ticks << ','
+            << r.timing.meanMs << ',' << r.timing.p50Ms << ',' << r.timing.p99Ms << ',' << r.timing.maxMs << ','
+            << r.allocationsPerTick << ',' << r.bytesPerTick << ',' << r.npcsAlive << '\n';
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::pair<int, int>> sizes;
+    std::vector<int> npcCounts;
+    int ticks = 600;
+    int warmupTicks = 60;
+    long long maxAllocations = -1;
+    std::string outPath;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        int columns = 0, rows = 0;
+        if (!std::strcmp(argv[i], "--size") && hasValue && std::sscanf(argv[i + 1], "%dx%d", &columns, &rows) == 2 && columns > 0 && rows > 0)
+        {
+            sizes.emplace_back(columns, rows);
+            ++i;
+        }
+        else if (!std::strcmp(argv[i], "--npcs") && hasValue)
+            npcCounts.push_back(std::max(0, std::atoi(argv[++i])));
+        else if (!std::strcmp(argv[i], "--ticks") && hasValue)
+            ticks = std::max(1, std::atoi(argv[++i]));
+        else if (!std::strcmp(argv[i], "--warmup") && hasValue)
+            warmupTicks = std::max(0, std::atoi(argv[++i]));
+        else if (!std::strcmp(argv[i], "--out") && hasValue)
+            outPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--max-allocs") && hasValue)
+            maxAllocations = std::max(0LL, std::atoll(argv[++i]));
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--size <W>x<H>]... [--npcs <N>]... [--ticks <K>] [--warmup <ticks>] [--out <results.csv>] [--max-allocs <N>]\n";
+            return 1;
+        }
+    }
+
+    if (sizes.empty())
+        sizes = {{GameLevel::mazeColumns, GameLevel::mazeRows}, {28, 16}, {56, 32}};
+    if (npcCounts.empty())
+        npcCounts = {0, 16, 64, 256};
+
+    std::ofstream out;
+    if (!outPath.empty())
+    {
+        out.open(outPath);
+        if (!out)
+        {
+            std::cerr << "stress: cannot write " << outPath << "\n";
+            return 1;
+        }
+        writeHeader(out);
+    }
+
+    if (maxAllocations >= 0 && !AllocationTracker::isEnabled())
+    {
+        std::cerr << "stress: --max-allocs needs a build with GAME_ENABLE_PROFILER=ON\n";
+        return 1;
+    }
+
+    ToolCommon::startHeadless();
+
+    // Le bus ignore les types sans abonné : la télémétrie fait passer la distribution par le chemin mesuré
+    GameplayTelemetry telemetry;
+    telemetry.subscribe(GameplayEventBus::getInstance());
+
+    int failures = 0;
+
+    writeHeader(std::cout);
+    for (const auto &size : sizes)
+    {
+        for (int npcs : npcCounts)
+        {
+            Report report = run({size.first, size.second, npcs}, ticks, warmupTicks);
+            writeReport(std::cout, report);
+            if (out.is_open())
+                writeReport(out, report);
+
+            if (maxAllocations >= 0 && report.allocations > static_cast<std::uint64_t>(maxAllocations))
+            {
+                std::cerr << "stress: " << size.first << "x" << size.second << " with " << npcs << " NPCs allocated "
+                          << report.allocations << " times in " << ticks << " ticks (max " << maxAllocations << ")\n";
+                ++failures;
+            }
+        }
+    }
+    return failures > 0 ? 2 : 0;
+}
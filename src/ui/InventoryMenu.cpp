@@ -1,63 +1,35 @@
 #include "InventoryMenu.hpp"
+#include "../resources/FontService.hpp"
 #include <iostream>
 #include <cmath>
 
 InventoryMenu::InventoryMenu() {
-    if (!font.loadFromFile("../src/assets/fonts/RobotoMono-Regular.ttf")) {
+    if (!FontService::isLoaded()) {
         std::cerr << "Erreur lors du chargement de la police pour l'inventaire" << std::endl;
     }
 }
 
-std::shared_ptr<sf::Texture> InventoryMenu::getTexture(const std::string& path) {
-    auto it = textureCache.find(path);
-    if (it != textureCache.end()) return it->second;
-
-    // Try several common prefixes
-    std::vector<std::string> tries = {path, "../src/" + path, "src/" + path, "../" + path};
-    for (const auto& p : tries) {
-        auto tex = std::make_shared<sf::Texture>();
-        if (tex->loadFromFile(p)) {
-            textureCache[path] = tex;
-            return tex;
-        }
-    }
-    // Debug: afficher les chemins essayés
-    std::cerr << "[InventoryMenu] Failed to load image '" << path << "'. Tried paths:";
-    for (const auto& p : tries) std::cerr << " '" << p << "'";
-    std::cerr << std::endl;
-    return nullptr;
+AtlasRegion InventoryMenu::getRegion(const std::string& path) {
+    // Les sprites d'items sont empaquetés dans l'atlas ("assets/images/items/x.png" -> "items/x.png")
+    return TextureAtlas::getDefault().getRegion(path);
 }
 
-sf::ConvexShape InventoryMenu::createRoundedRect(sf::Vector2f size, float radius, int cornerSegments) {
+/**
+ * @brief Points d'un rectangle arrondi, dans l'ordre (coins haut-gauche, haut-droit, bas-droit, bas-gauche)
+ */
+std::vector<sf::Vector2f> InventoryMenu::roundedRectPoints(sf::Vector2f pos, sf::Vector2f size, float radius, int cornerSegments, float grow) {
+    std::vector<sf::Vector2f> points;
     if (radius <= 0.f) {
-        sf::ConvexShape r;
-        r.setPointCount(4);
-        r.setPoint(0, {0.f, 0.f});
-        r.setPoint(1, {size.x, 0.f});
-        r.setPoint(2, {size.x, size.y});
-        r.setPoint(3, {0.f, size.y});
-        return r;
+        points = {{pos.x - grow, pos.y - grow}, {pos.x + size.x + grow, pos.y - grow},
+                  {pos.x + size.x + grow, pos.y + size.y + grow}, {pos.x - grow, pos.y + size.y + grow}};
+        return points;
     }
 
-    int segments = std::max(1, cornerSegments);
-    sf::ConvexShape shape;
-    shape.setPointCount(segments * 4);
-
-    auto addArc = [&](float cx, float cy, float startAngle) {
-        for (int s = 0; s < segments; ++s) {
-            float t = static_cast<float>(s) / static_cast<float>(segments - 1);
-            float angle = startAngle + t * (M_PI_2);
-            float x = cx + std::cos(angle) * radius;
-            float y = cy + std::sin(angle) * radius;
-            shape.setPoint((int)shape.getPointCount() - 1, {x, y});
-        }
-    };
-
-    // We'll compute points manually
-    int idx = 0;
+    int segments = std::max(2, cornerSegments);
+    points.reserve(static_cast<size_t>(segments) * 4);
     for (int corner = 0; corner < 4; ++corner) {
-        float cx = (corner == 0 || corner == 3) ? radius : size.x - radius;
-        float cy = (corner == 0 || corner == 1) ? radius : size.y - radius;
+        float cx = pos.x + ((corner == 0 || corner == 3) ? radius : size.x - radius);
+        float cy = pos.y + ((corner == 0 || corner == 1) ? radius : size.y - radius);
         float startAngle = 0.f;
         switch (corner) {
             case 0: startAngle = M_PI; break;            // top-left: PI -> 3PI/2
@@ -68,33 +40,111 @@ sf::ConvexShape InventoryMenu::createRoundedRect(sf::Vector2f size, float radius
         for (int s = 0; s < segments; ++s) {
             float t = static_cast<float>(s) / static_cast<float>(segments - 1);
             float angle = startAngle + t * (M_PI_2);
-            float x = cx + std::cos(angle) * radius;
-            float y = cy + std::sin(angle) * radius;
-            shape.setPoint(idx++, {x, y});
+            points.emplace_back(cx + std::cos(angle) * (radius + grow), cy + std::sin(angle) * (radius + grow));
+        }
+    }
+    return points;
+}
+
+void InventoryMenu::appendRoundedRect(sf::VertexArray& vertices, sf::Vector2f pos, sf::Vector2f size, float radius, int cornerSegments, const sf::Color& color) {
+    std::vector<sf::Vector2f> points = roundedRectPoints(pos, size, radius, cornerSegments, 0.f);
+    sf::Vector2f center(pos.x + size.x / 2.f, pos.y + size.y / 2.f);
+    for (size_t i = 0; i < points.size(); ++i) {
+        vertices.append(sf::Vertex(center, color));
+        vertices.append(sf::Vertex(points[i], color));
+        vertices.append(sf::Vertex(points[(i + 1) % points.size()], color));
+    }
+}
+
+void InventoryMenu::appendRoundedOutline(sf::VertexArray& vertices, sf::Vector2f pos, sf::Vector2f size, float radius, int cornerSegments, float thickness, const sf::Color& color) {
+    std::vector<sf::Vector2f> inner = roundedRectPoints(pos, size, radius, cornerSegments, 0.f);
+    std::vector<sf::Vector2f> outer = roundedRectPoints(pos, size, radius, cornerSegments, thickness);
+    for (size_t i = 0; i < inner.size(); ++i) {
+        size_t j = (i + 1) % inner.size();
+        vertices.append(sf::Vertex(inner[i], color));
+        vertices.append(sf::Vertex(outer[i], color));
+        vertices.append(sf::Vertex(outer[j], color));
+        vertices.append(sf::Vertex(inner[i], color));
+        vertices.append(sf::Vertex(outer[j], color));
+        vertices.append(sf::Vertex(inner[j], color));
+    }
+}
+
+void InventoryMenu::draw(sf::RenderWindow& window, const InventoryView& view) {
+    if (needsRebuild(window, view))
+        rebuild(window, view);
+
+    window.draw(panel);
+    if (iconTexture)
+        window.draw(icons, iconTexture.get());
+    for (const auto& text : texts)
+        window.draw(text);
+}
+
+void InventoryMenu::capture(const GameCharacter& character, InventoryView& view) const {
+    const auto& inventory = character.getInventory();
+    for (size_t i = 0; i < view.slots.size(); ++i) {
+        InventoryView::Slot& slot = view.slots[i];
+        if (i >= inventory.size() || inventory[i].stack.empty()) {
+            slot.count = 0;
+            slot.name.clear();
+            slot.spritePath.clear();
+            continue;
         }
+        // assign() réutilise la capacité des chaînes de l'instantané
+        slot.count = inventory[i].stack.size();
+        slot.name.assign(inventory[i].itemTypeName);
+        slot.spritePath.assign(inventory[i].stack.top()->getSpritePath());
     }
+    view.selectedSlot = selectedSlot;
+}
 
-    return shape;
+/**
+ * @brief Indique si le contenu affiché a changé depuis la dernière construction
+ */
+bool InventoryMenu::needsRebuild(const sf::RenderWindow& window, const InventoryView& view) const {
+    if (!cacheValid || view.selectedSlot != cachedView.selectedSlot || window.getSize() != cachedWindowSize)
+        return true;
+    for (size_t i = 0; i < view.slots.size(); ++i) {
+        const InventoryView::Slot& a = view.slots[i];
+        const InventoryView::Slot& b = cachedView.slots[i];
+        if (a.count != b.count || a.name != b.name || a.spritePath != b.spritePath)
+            return true;
+    }
+    return false;
 }
 
-void InventoryMenu::draw(sf::RenderWindow& window, const GameCharacter& character) {
+/**
+ * @brief Construit le panneau : un tableau de triangles, un tableau de quads d'icônes et les textes
+ */
+void InventoryMenu::rebuild(const sf::RenderWindow& window, const InventoryView& view) {
+    panel.clear();
+    icons.clear();
+    texts.clear();
+    iconTexture.reset();
+
     // Fond semi-transparent
-    sf::RectangleShape overlay(sf::Vector2f(window.getSize().x, window.getSize().y));
-    overlay.setFillColor(sf::Color(0, 0, 0, 200));
-    window.draw(overlay);
+    const sf::Vector2f windowSize(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y));
+    const sf::Color overlayColor(0, 0, 0, 200);
+    panel.append(sf::Vertex(sf::Vector2f(0.f, 0.f), overlayColor));
+    panel.append(sf::Vertex(sf::Vector2f(windowSize.x, 0.f), overlayColor));
+    panel.append(sf::Vertex(windowSize, overlayColor));
+    panel.append(sf::Vertex(sf::Vector2f(0.f, 0.f), overlayColor));
+    panel.append(sf::Vertex(windowSize, overlayColor));
+    panel.append(sf::Vertex(sf::Vector2f(0.f, windowSize.y), overlayColor));
 
     // Titre
     sf::Text invTitle;
-    invTitle.setFont(font);
+    invTitle.setFont(FontService::getFont());
     invTitle.setString("INVENTAIRE");
     invTitle.setCharacterSize(60);
     invTitle.setFillColor(sf::Color::White);
     sf::FloatRect titleBounds = invTitle.getLocalBounds();
     invTitle.setPosition(960.f - titleBounds.width / 2.f, 100.f);
-    window.draw(invTitle);
+    texts.push_back(invTitle);
 
     // Affichage des piles d'items
-    const auto& inventory = character.getInventory();
+    const auto& inventory = view.slots;
     float startX = 300.f;
     float y = 300.f;
     float slotWidth = 120.f;
@@ -104,65 +154,62 @@ void InventoryMenu::draw(sf::RenderWindow& window, const GameCharacter& characte
 
     for (int i = 0; i < slotCount; ++i) {
         sf::Vector2f pos(startX + i * (slotWidth + 20.f), y);
-        // Rounded rect background
-        sf::ConvexShape bg = createRoundedRect({slotWidth, slotHeight}, radius, 8);
-        bg.setPosition(pos);
-        bg.setFillColor(unselectedColor);
-        bg.setOutlineThickness(0.f);
-        window.draw(bg);
+        appendRoundedRect(panel, pos, {slotWidth, slotHeight}, radius, 8, unselectedColor);
 
         // If selected, draw a white outline rounded rect
-        if (i == selectedSlot) {
-            sf::ConvexShape outline = createRoundedRect({slotWidth, slotHeight}, radius, 8);
-            outline.setPosition(pos);
-            outline.setFillColor(sf::Color::Transparent);
-            outline.setOutlineColor(sf::Color::White);
-            outline.setOutlineThickness(3.f);
-            window.draw(outline);
-        }
+        if (i == view.selectedSlot)
+            appendRoundedOutline(panel, pos, {slotWidth, slotHeight}, radius, 8, 3.f, sf::Color::White);
 
         // Draw item sprite if present
-        if (!inventory[i].stack.empty()) {
-            const std::string& spritePath = inventory[i].stack.top()->getSpritePath();
-            auto tex = getTexture(spritePath);
-            if (tex) {
-                sf::Sprite s;
-                s.setTexture(*tex);
+        if (inventory[i].count > 0) {
+            const std::string& spritePath = inventory[i].spritePath;
+            AtlasRegion region = getRegion(spritePath);
+            if (region.texture && region.rect.width > 0 && region.rect.height > 0) {
+                iconTexture = region.texture;
                 // Scale to fit inside slot with some padding
                 float padding = 12.f;
                 float availW = slotWidth - 2.f * padding;
                 float availH = slotHeight - 2.f * padding;
-                float tw = static_cast<float>(tex->getSize().x);
-                float th = static_cast<float>(tex->getSize().y);
+                float tw = static_cast<float>(region.rect.width);
+                float th = static_cast<float>(region.rect.height);
                 float scale = std::min(availW / tw, availH / th);
-                s.setScale(scale, scale);
                 float drawW = tw * scale;
                 float drawH = th * scale;
-                s.setPosition(pos.x + (slotWidth - drawW) / 2.f, pos.y + (slotHeight - drawH) / 2.f - 8.f);
-                window.draw(s);
+                float left = pos.x + (slotWidth - drawW) / 2.f;
+                float top = pos.y + (slotHeight - drawH) / 2.f - 8.f;
+                float u = static_cast<float>(region.rect.left);
+                float v = static_cast<float>(region.rect.top);
+                icons.append(sf::Vertex(sf::Vector2f(left, top), sf::Vector2f(u, v)));
+                icons.append(sf::Vertex(sf::Vector2f(left + drawW, top), sf::Vector2f(u + tw, v)));
+                icons.append(sf::Vertex(sf::Vector2f(left + drawW, top + drawH), sf::Vector2f(u + tw, v + th)));
+                icons.append(sf::Vertex(sf::Vector2f(left, top + drawH), sf::Vector2f(u, v + th)));
             }
 
             // Afficher le nombre
             sf::Text itemText;
-            itemText.setFont(font);
+            itemText.setFont(FontService::getFont());
             itemText.setCharacterSize(12);
-            itemText.setString(inventory[i].itemTypeName + " x" + std::to_string((int)inventory[i].stack.size()));
+            itemText.setString(inventory[i].name + " x" + std::to_string((int)inventory[i].count));
             itemText.setFillColor(sf::Color::White);
             sf::FloatRect bounds = itemText.getLocalBounds();
             itemText.setPosition(pos.x + slotWidth / 2.f - bounds.width / 2.f, pos.y + slotHeight + 30.f);
-            window.draw(itemText);
+            texts.push_back(itemText);
         } else {
             // Empty label
             sf::Text itemText;
-            itemText.setFont(font);
+            itemText.setFont(FontService::getFont());
             itemText.setCharacterSize(18);
             itemText.setString("Vide");
             itemText.setFillColor(sf::Color::White);
             sf::FloatRect bounds = itemText.getLocalBounds();
             itemText.setPosition(pos.x + slotWidth / 2.f - bounds.width / 2.f, pos.y + slotHeight / 2.f - bounds.height / 2.f);
-            window.draw(itemText);
+            texts.push_back(itemText);
         }
     }
+
+    cachedView = view;
+    cacheValid = true;
+    cachedWindowSize = window.getSize();
 }
 
 void InventoryMenu::moveSelection(int direction) {
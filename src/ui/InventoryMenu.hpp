@@ -5,26 +5,45 @@
 #include <unordered_map>
 #include <memory>
 #include "../characters/GameCharacter.hpp"
+#include "../resources/TextureAtlas.hpp"
+#include "UIViews.hpp"
 
 class InventoryMenu {
 public:
     InventoryMenu();
-    void draw(sf::RenderWindow& window, const GameCharacter& character);
+    // Dessine le contenu d'un instantané (thread de rendu)
+    void draw(sf::RenderWindow& window, const InventoryView& view);
+    // Recopie l'inventaire du personnage et la sélection courante (thread de simulation)
+    void capture(const GameCharacter& character, InventoryView& view) const;
     void moveSelection(int direction); // -1: gauche, +1: droite
     int getSelectedSlot() const { return selectedSlot; }
+    void setSelectedSlot(int slot) { selectedSlot = slot; } // sélection tenue par EventManager
     void resetSelection() { selectedSlot = 0; }
 
 private:
-    sf::Font font;
     int selectedSlot = 0;
     sf::Color unselectedColor = sf::Color(80,80,80,180);
 
-    // Textures cache pour les sprites d'items
-    std::unordered_map<std::string, std::shared_ptr<sf::Texture>> textureCache;
+    // --- Géométrie en cache : reconstruite quand le contenu, la sélection ou la fenêtre change ---
+    InventoryView cachedView;
+    bool cacheValid = false;
+    sf::Vector2u cachedWindowSize;
 
-    // Helper: charge et met en cache une texture
-    std::shared_ptr<sf::Texture> getTexture(const std::string& path);
+    sf::VertexArray panel{sf::Triangles};   // fond, cases arrondies, contour de sélection
+    sf::VertexArray icons{sf::Quads};       // sprites des items (tous dans l'atlas)
+    std::shared_ptr<sf::Texture> iconTexture;
+    std::vector<sf::Text> texts;
 
-    // Helper: crée une forme convexe approximant un rectangle arrondi
-    sf::ConvexShape createRoundedRect(sf::Vector2f size, float radius, int cornerSegments = 8);
+    bool needsRebuild(const sf::RenderWindow& window, const InventoryView& view) const;
+    void rebuild(const sf::RenderWindow& window, const InventoryView& view);
+
+    // Helper: retrouve la région de l'atlas correspondant au sprite d'un item
+    AtlasRegion getRegion(const std::string& path);
+
+    // Helper: ajoute un rectangle arrondi plein (éventail de triangles)
+    static void appendRoundedRect(sf::VertexArray& vertices, sf::Vector2f pos, sf::Vector2f size, float radius, int cornerSegments, const sf::Color& color);
+    // Helper: ajoute le contour extérieur d'un rectangle arrondi (anneau de triangles)
+    static void appendRoundedOutline(sf::VertexArray& vertices, sf::Vector2f pos, sf::Vector2f size, float radius, int cornerSegments, float thickness, const sf::Color& color);
+    // Points du contour d'un rectangle arrondi (rayon agrandi de grow, mêmes centres d'arc)
+    static std::vector<sf::Vector2f> roundedRectPoints(sf::Vector2f pos, sf::Vector2f size, float radius, int cornerSegments, float grow);
 };
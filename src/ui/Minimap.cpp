@@ -0,0 +1,126 @@
+#include "Minimap.hpp"
+#include "../blocks/BlockTypeUtils.hpp"
+#include "../objects/Door.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    const sf::Color FloorColor(30, 30, 40);
+    const sf::Color WallColor(200, 190, 170);
+    const sf::Color FogColor(0, 0, 0, 230);
+}
+
+void Minimap::build(const std::vector<Node *> &grid, int columns, int rows, const sf::Vector2f &cellSize,
+                    const std::vector<std::unique_ptr<Object>> &objects)
+{
+    this->columns = std::max(columns, 0);
+    this->rows = std::max(rows, 0);
+    this->cellSize = cellSize;
+    fogValid = false;
+
+    const unsigned px = pixelsPerCell;
+    sf::Image image;
+    image.create(std::max(1u, static_cast<unsigned>(this->columns) * px), std::max(1u, static_cast<unsigned>(this->rows) * px), FloorColor);
+
+    // Un mur sur chaque côté sans sortie (même convention que ExitBlock)
+    for (Node *n : grid)
+    {
+        int cx = n->getxPos();
+        int cy = n->getyPos();
+        if (cx < 0 || cy < 0 || cx >= this->columns || cy >= this->rows)
+            continue;
+        BlockType mask = getBlockTypeFromNode(n);
+        unsigned x0 = static_cast<unsigned>(cx) * px;
+        unsigned y0 = static_cast<unsigned>(cy) * px;
+        for (unsigned i = 0; i < px; ++i)
+        {
+            if (!(mask & TOP_EXIT))
+                image.setPixel(x0 + i, y0, WallColor);
+            if (!(mask & BOTTOM_EXIT))
+                image.setPixel(x0 + i, y0 + px - 1, WallColor);
+            if (!(mask & LEFT_EXIT))
+                image.setPixel(x0, y0 + i, WallColor);
+            if (!(mask & RIGHT_EXIT))
+                image.setPixel(x0 + px - 1, y0 + i, WallColor);
+        }
+    }
+    texture.loadFromImage(image);
+
+    doors.clear();
+    for (const auto &obj : objects)
+    {
+        if (const Door *door = dynamic_cast<const Door *>(obj.get()))
+        {
+            sf::FloatRect b = door->getBounds();
+            doors.push_back({worldToMap(sf::Vector2f(b.left + b.width / 2.f, b.top + b.height / 2.f)),
+                             door->getDoorType() == Door::DoorType::ExitDoor});
+        }
+    }
+}
+
+void Minimap::draw(sf::RenderWindow &window, const sf::Vector2f &playerPosition, const Explored &explored)
+{
+    if (!fogValid || fogExplored != explored)
+        rebuildFog(explored);
+
+    sf::View previousView = window.getView();
+    window.setView(window.getDefaultView());
+
+    // La carte occupe au plus 80% de la fenêtre, centrée, sans déformation
+    const sf::Vector2f windowSize(window.getSize());
+    const sf::Vector2f mapSize(static_cast<float>(texture.getSize().x), static_cast<float>(texture.getSize().y));
+    const float scale = std::min(windowSize.x * 0.8f / mapSize.x, windowSize.y * 0.8f / mapSize.y);
+    sf::Transform transform;
+    transform.translate((windowSize.x - mapSize.x * scale) / 2.f, (windowSize.y - mapSize.y * scale) / 2.f);
+    transform.scale(scale, scale);
+
+    sf::Sprite map(texture);
+    window.draw(map, transform);
+    window.draw(fog, transform);
+
+    // Marqueurs dynamiques
+    sf::CircleShape marker(4.f);
+    marker.setOrigin(4.f, 4.f);
+    for (const auto &door : doors)
+    {
+        marker.setFillColor(door.isExit ? sf::Color::Cyan : sf::Color(120, 120, 255));
+        marker.setPosition(door.position);
+        window.draw(marker, transform);
+    }
+    marker.setFillColor(sf::Color::Yellow);
+    marker.setPosition(worldToMap(playerPosition));
+    window.draw(marker, transform);
+
+    window.setView(previousView);
+}
+
+/**
+ * @brief Recouvre les cellules non explorées (appelé seulement quand les cellules explorées ont changé).
+ */
+void Minimap::rebuildFog(const Explored &explored)
+{
+    fog.clear();
+    const float px = static_cast<float>(pixelsPerCell);
+    for (int row = 0; row < rows; ++row)
+    {
+        for (int col = 0; col < columns; ++col)
+        {
+            if (explored.test(static_cast<size_t>(row * columns + col)))
+                continue;
+            float x = col * px;
+            float y = row * px;
+            fog.append(sf::Vertex(sf::Vector2f(x, y), FogColor));
+            fog.append(sf::Vertex(sf::Vector2f(x + px, y), FogColor));
+            fog.append(sf::Vertex(sf::Vector2f(x + px, y + px), FogColor));
+            fog.append(sf::Vertex(sf::Vector2f(x, y + px), FogColor));
+        }
+    }
+    fogExplored = explored;
+    fogValid = true;
+}
+
+sf::Vector2f Minimap::worldToMap(const sf::Vector2f &worldPosition) const
+{
+    return sf::Vector2f(worldPosition.x / cellSize.x * pixelsPerCell, worldPosition.y / cellSize.y * pixelsPerCell);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+#include "../environnement/Node.hpp"
+#include "../levels/ExploredCells.hpp"
+
+class Object;
+
+/**
+ * @brief Carte du niveau affichée par la vue carte (touche M).
+ *
+ * La texture de la carte est générée une fois à la construction du niveau à partir des
+ * masques de murs des cellules (quelques pixels par cellule). Les cellules explorées sont
+ * un ensemble de bits tenu par le niveau (GameLevel::markExplored) et recopié dans l'instantané de
+ * rendu ; le brouillard n'est recalculé que lorsque cet ensemble change. Seuls les marqueurs
+ * (joueur, portes) sont dessinés à chaque frame.
+ * @note Après build(), la carte n'est utilisée que par le thread de rendu.
+ */
+class Minimap
+{
+public:
+    static constexpr unsigned pixelsPerCell = 16;
+    using Explored = ExploredCells;
+
+    /**
+     * @brief Génère la texture de la carte
+     * @param grid Les cellules du labyrinthe
+     * @param columns Nombre de colonnes
+     * @param rows Nombre de lignes
+     * @param cellSize Taille d'une cellule en coordonnées monde
+     * @param objects Objets du niveau (les portes deviennent des marqueurs)
+     */
+    void build(const std::vector<Node *> &grid, int columns, int rows, const sf::Vector2f &cellSize,
+               const std::vector<std::unique_ptr<Object>> &objects);
+
+    /**
+     * @brief Dessine la carte, centrée dans la vue par défaut de la fenêtre
+     * @param playerPosition Position du joueur dans le monde
+     * @param explored Cellules explorées (le brouillard est refait seulement s'il a changé)
+     */
+    void draw(sf::RenderWindow &window, const sf::Vector2f &playerPosition, const Explored &explored);
+
+private:
+    struct DoorMarker
+    {
+        sf::Vector2f position; // en pixels de la carte
+        bool isExit;
+    };
+
+    sf::Texture texture;
+    sf::Vector2f cellSize{1.f, 1.f};
+    int columns = 0;
+    int rows = 0;
+    std::vector<DoorMarker> doors;
+
+    sf::VertexArray fog{sf::Quads};
+    Explored fogExplored;
+    bool fogValid = false;
+
+    void rebuildFog(const Explored &explored);
+    sf::Vector2f worldToMap(const sf::Vector2f &worldPosition) const;
+};
@@ -1,4 +1,5 @@
 #include "PauseMenu.hpp"
+#include "../resources/FontService.hpp"
 #include <iostream>
 
 PauseMenu::PauseMenu() : selectedOption(MenuOption::Continue)
@@ -8,8 +9,9 @@ PauseMenu::PauseMenu() : selectedOption(MenuOption::Continue)
 
 void PauseMenu::initializeMenu()
 {
-    // Charger la police
-    if (!font.loadFromFile("../src/assets/fonts/RobotoMono-Regular.ttf"))
+    // Police partagée (chargée une seule fois pour toute l'UI)
+    const sf::Font &font = FontService::getFont();
+    if (!FontService::isLoaded())
     {
         std::cerr << "Erreur lors du chargement de la police pour le menu de pause" << std::endl;
         // On continue quand même avec une police par défaut
@@ -51,7 +53,7 @@ void PauseMenu::draw(sf::RenderWindow& window)
     
     // Dessiner le titre
     sf::Text pauseTitle;
-    pauseTitle.setFont(font);
+    pauseTitle.setFont(FontService::getFont());
     pauseTitle.setString("PAUSE");
     pauseTitle.setCharacterSize(80);
     pauseTitle.setFillColor(sf::Color::White);
@@ -82,3 +84,12 @@ void PauseMenu::moveSelection(int direction)
     selectedOption = static_cast<MenuOption>(newIndex);
     menuItems[newIndex].setFillColor(selectedColor);
 }
+
+void PauseMenu::setSelectedOption(MenuOption option)
+{
+    if (option == selectedOption)
+        return;
+    selectedOption = option;
+    for (size_t i = 0; i < menuItems.size(); ++i)
+        menuItems[i].setFillColor(static_cast<int>(i) == static_cast<int>(option) ? selectedColor : unselectedColor);
+}
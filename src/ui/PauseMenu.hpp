@@ -19,10 +19,11 @@ public:
     void moveSelection(int direction);
     MenuOption getSelectedOption() const { return selectedOption; }
     void resetSelection() { selectedOption = MenuOption::Continue; }
+    // Applique une sélection venue de la simulation (menu dessiné par le thread de rendu)
+    void setSelectedOption(MenuOption option);
     
 private:
     MenuOption selectedOption;
-    sf::Font font;
     std::vector<sf::Text> menuItems;
     
     void initializeMenu();
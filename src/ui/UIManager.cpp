@@ -1,81 +1,63 @@
 #include "UIManager.hpp"
 #include "../characters/GameCharacter.hpp"
-#include <sstream>
+#include "../resources/FontService.hpp"
 #include <iostream>
-#include <filesystem>
 
 UIManager::UIManager()
 {
-    // Try multiple possible paths for the font
-    std::vector<std::string> fontPaths = {
-        "../src/assets/fonts/RobotoMono-Regular.ttf",
-        "src/assets/fonts/RobotoMono-Regular.ttf",
-        "assets/fonts/RobotoMono-Regular.ttf",
-        "../../src/assets/fonts/RobotoMono-Regular.ttf"
-    };
-
-    fontLoaded = false;
-    for (const auto& path : fontPaths)
-    {
-        if (font.loadFromFile(path))
-        {
-            fontLoaded = true;
-            break;
-        }
-    }
-
+    fontLoaded = FontService::isLoaded();
     if (!fontLoaded)
     {
-        std::cerr << "Failed to load font for UIManager (tried " << fontPaths.size() << " paths)" << std::endl;
+        std::cerr << "Failed to load font for UIManager" << std::endl;
     }
 
     // Initialiser le menu d'inventaire
     inventoryMenu = InventoryMenu();
 }
-void UIManager::drawInventoryMenu(sf::RenderWindow& window, const GameCharacter& character) {
-    inventoryMenu.draw(window, character);
+void UIManager::drawInventoryMenu(sf::RenderWindow& window, const InventoryView& view) {
+    inventoryMenu.draw(window, view);
 }
 
 InventoryMenu& UIManager::getInventoryMenu() {
     return inventoryMenu;
 }
 
-void UIManager::drawHealthBars(sf::RenderWindow& window, const std::vector<GameCharacter*>& allCharacters, GameCharacter* playerPtr)
+void UIManager::drawHealthBars(sf::RenderTarget& target, const std::vector<HealthBarView>& bars)
 {
-    for (auto character : allCharacters)
+    healthBarVertices.clear();
+    for (const auto &bar : bars)
     {
-        // Skip the player
-        if (character == playerPtr)
-            continue;
-
         // Draw health bar above the character's head
-        sf::Vector2f characterPos = character->getPosition();
-        float barX = characterPos.x + character->getBounds().width / 2.f - barWidth / 2.f;
-        float barY = characterPos.y + barOffsetY;
+        float barX = bar.position.x + bar.width / 2.f - barWidth / 2.f;
+        float barY = bar.position.y + barOffsetY;
 
-        drawHealthBar(window, barX, barY, character->getHp(), character->getMaxHp());
+        appendHealthBar(healthBarVertices, barX, barY, bar.hp, bar.maxHp);
     }
+    if (healthBarVertices.getVertexCount() > 0)
+        target.draw(healthBarVertices);
 }
 
 void UIManager::drawPlayerHealthBar(sf::RenderWindow& window, const GameCharacter& player)
 {
     // Draw player health bar in bottom left
-    drawHealthBar(window, 10.f, window.getSize().y - 30.f, player.getHp(), player.getMaxHp());
+    healthBarVertices.clear();
+    appendHealthBar(healthBarVertices, 10.f, window.getSize().y - 30.f, player.getHp(), player.getMaxHp());
+    window.draw(healthBarVertices);
 
-    // Draw player HP text
+    // Draw player HP text (reformaté seulement quand les valeurs changent)
     if (fontLoaded)
     {
-        sf::Text hpText;
-        hpText.setFont(font);
-        hpText.setCharacterSize(32);
-        hpText.setFillColor(sf::Color::White);
-
-        std::stringstream ss;
-        ss << "HP: " << player.getHp() << " / " << player.getMaxHp();
-        hpText.setString(ss.str());
-        hpText.setPosition(10.f, window.getSize().y - 50.f);
-
-        window.draw(hpText);
+        if (!playerHpValid || player.getHp() != playerHpKey.x || player.getMaxHp() != playerHpKey.y)
+        {
+            playerHpKey = sf::Vector2i(player.getHp(), player.getMaxHp());
+            playerHpValid = true;
+            playerHpText.setFont(FontService::getFont());
+            playerHpText.setCharacterSize(32);
+            playerHpText.setFillColor(sf::Color::White);
+            playerHpText.setString("HP: " + std::to_string(playerHpKey.x) + " / " + std::to_string(playerHpKey.y));
+        }
+        playerHpText.setPosition(10.f, window.getSize().y - 50.f);
+        window.draw(playerHpText);
     }
 }
 
@@ -84,222 +66,157 @@ void UIManager::drawPlayerMana(sf::RenderWindow& window, const GameCharacter& pl
     if (!fontLoaded)
         return;
 
-    sf::Text manaText;
-    manaText.setFont(font);
-    manaText.setCharacterSize(32);
-    manaText.setFillColor(sf::Color::Cyan);
-
-    std::stringstream ss;
-    ss << "Mana: " << player.getMana() << " / " << player.getMaxMana();
-    manaText.setString(ss.str());
-    manaText.setPosition(10.f, window.getSize().y - 30.f);
-
-    window.draw(manaText);
+    if (!playerManaValid || player.getMana() != playerManaKey.x || player.getMaxMana() != playerManaKey.y)
+    {
+        playerManaKey = sf::Vector2i(player.getMana(), player.getMaxMana());
+        playerManaValid = true;
+        playerManaText.setFont(FontService::getFont());
+        playerManaText.setCharacterSize(32);
+        playerManaText.setFillColor(sf::Color::Cyan);
+        playerManaText.setString("Mana: " + std::to_string(playerManaKey.x) + " / " + std::to_string(playerManaKey.y));
+    }
+    playerManaText.setPosition(10.f, window.getSize().y - 30.f);
+    window.draw(playerManaText);
 }
 
-void UIManager::drawHealthBar(sf::RenderWindow& window, float x, float y, int currentHP, int maxHP)
+void UIManager::appendHealthBar(sf::VertexArray& vertices, float x, float y, int currentHP, int maxHP)
 {
     // Background bar (red/empty)
-    sf::RectangleShape backgroundBar(sf::Vector2f(barWidth, barHeight));
-    backgroundBar.setPosition(x, y);
-    backgroundBar.setFillColor(sf::Color::Red);
-    window.draw(backgroundBar);
+    sf::FloatRect area(x, y, barWidth, barHeight);
+    appendRect(vertices, area, sf::Color::Red);
 
     // Health bar (green/filled based on ratio)
     if (maxHP > 0)
     {
         float healthRatio = static_cast<float>(currentHP) / static_cast<float>(maxHP);
-        float filledWidth = barWidth * healthRatio;
-
-        sf::RectangleShape healthBar(sf::Vector2f(filledWidth, barHeight));
-        healthBar.setPosition(x, y);
-        healthBar.setFillColor(sf::Color::Green);
-        window.draw(healthBar);
+        appendRect(vertices, sf::FloatRect(x, y, barWidth * healthRatio, barHeight), sf::Color::Green);
     }
 
     // Border
-    sf::RectangleShape border(sf::Vector2f(barWidth, barHeight));
-    border.setPosition(x, y);
-    border.setFillColor(sf::Color::Transparent);
-    border.setOutlineColor(sf::Color::White);
-    border.setOutlineThickness(0.5f);
-    window.draw(border);
+    appendOutline(vertices, area, 0.5f, sf::Color::White);
 }
 
-void UIManager::drawPlayerHUD(sf::RenderWindow& window, const GameCharacter& player, int currentLevel)
+void UIManager::drawPlayerHUD(sf::RenderWindow& window, const HudView& hud)
 {
-    // Save current view to restore it after rendering UI in screen space
-    sf::View currentView = window.getView();
-    window.setView(window.getDefaultView());
-
-    const float hudX = 20.f;
-    float hudY = window.getSize().y - 280.f;
-    const float lineHeight = 65.f;
-    const float barY = hudY + 15.f;
-
     if (!fontLoaded)
-    {
-        window.setView(currentView);
         return;
-    }
-
-    // --- HP Bar ---
-    sf::Text hpLabel;
-    hpLabel.setFont(font);
-    hpLabel.setString("HP");
-    hpLabel.setCharacterSize(38);
-    hpLabel.setFillColor(sf::Color::White);
-    hpLabel.setPosition(hudX, hudY);
-    window.draw(hpLabel);
-
-    // Draw HP bar directly with large size for HUD (not using drawHealthBar for enemy bars)
-    const float hudBarWidth = 120.f;
-    const float hudBarHeight = 15.f;
-    
-    sf::RectangleShape hpBackgroundBar(sf::Vector2f(hudBarWidth, hudBarHeight));
-    hpBackgroundBar.setPosition(hudX + 180.f, barY);
-    hpBackgroundBar.setFillColor(sf::Color::Red);
-    window.draw(hpBackgroundBar);
 
-    if (player.getMaxHp() > 0)
+    HudSnapshot snapshot{hud.hp, hud.maxHp, hud.mana, hud.maxMana,
+                         hud.endurance, hud.maxEndurance, hud.level, window.getSize().y};
+    if (!hudValid || !(snapshot == hudSnapshot))
     {
-        float healthRatio = static_cast<float>(player.getHp()) / static_cast<float>(player.getMaxHp());
-        float filledWidth = hudBarWidth * healthRatio;
-
-        sf::RectangleShape hpBar(sf::Vector2f(filledWidth, hudBarHeight));
-        hpBar.setPosition(hudX + 180.f, barY);
-        hpBar.setFillColor(sf::Color::Green);
-        window.draw(hpBar);
-    }
-
-    sf::RectangleShape hpBorder(sf::Vector2f(hudBarWidth, hudBarHeight));
-    hpBorder.setPosition(hudX + 180.f, barY);
-    hpBorder.setFillColor(sf::Color::Transparent);
-    hpBorder.setOutlineColor(sf::Color::White);
-    hpBorder.setOutlineThickness(1.5f);
-    window.draw(hpBorder);
-
-    // --- HP Text ---
-    sf::Text hpText;
-    hpText.setFont(font);
-    hpText.setCharacterSize(38);
-    hpText.setFillColor(sf::Color::White);
-    {
-        std::stringstream ss;
-        ss << player.getHp() << "/" << player.getMaxHp();
-        hpText.setString(ss.str());
+        rebuildHud(snapshot);
+        hudSnapshot = snapshot;
+        hudValid = true;
     }
-    hpText.setPosition(hudX + 320.f, hudY);
-    window.draw(hpText);
 
-    // --- Mana Bar ---
-    hudY += lineHeight;
-    sf::Text manaLabel;
-    manaLabel.setFont(font);
-    manaLabel.setString("Mana");
-    manaLabel.setCharacterSize(38);
-    manaLabel.setFillColor(sf::Color::Cyan);
-    manaLabel.setPosition(hudX, hudY);
-    window.draw(manaLabel);
-
-    // Draw mana bar (cyan color)
-    sf::RectangleShape manaBackgroundBar(sf::Vector2f(hudBarWidth, hudBarHeight));
-    manaBackgroundBar.setPosition(hudX + 180.f, hudY + 15.f);
-    manaBackgroundBar.setFillColor(sf::Color::Blue);
-    window.draw(manaBackgroundBar);
+    // Save current view to restore it after rendering UI in screen space
+    sf::View currentView = window.getView();
+    window.setView(window.getDefaultView());
 
-    if (player.getMaxMana() > 0)
-    {
-        float manaRatio = static_cast<float>(player.getMana()) / static_cast<float>(player.getMaxMana());
-        float filledWidth = hudBarWidth * manaRatio;
+    window.draw(hudBars);
+    for (const auto &text : hudTexts)
+        window.draw(text);
 
-        sf::RectangleShape manaBar(sf::Vector2f(filledWidth, hudBarHeight));
-        manaBar.setPosition(hudX + 180.f, hudY + 15.f);
-        manaBar.setFillColor(sf::Color::Cyan);
-        window.draw(manaBar);
-    }
+    // Restore view
+    window.setView(currentView);
+}
 
-    sf::RectangleShape manaBorder(sf::Vector2f(hudBarWidth, hudBarHeight));
-    manaBorder.setPosition(hudX + 180.f, hudY + 15.f);
-    manaBorder.setFillColor(sf::Color::Transparent);
-    manaBorder.setOutlineColor(sf::Color::White);
-    manaBorder.setOutlineThickness(1.5f);
-    window.draw(manaBorder);
+/**
+ * @brief Recalcule la géométrie du HUD (barres en un seul tableau de quads + textes)
+ * @note Appelé seulement quand une valeur affichée change ; les textes sont créés une fois,
+ * seuls ceux dont la valeur a changé sont reformatés
+ */
+void UIManager::rebuildHud(const HudSnapshot& snapshot)
+{
+    const float hudX = 20.f;
+    float hudY = static_cast<float>(snapshot.windowHeight) - 280.f;
+    const float lineHeight = 65.f;
+    const float hudBarWidth = 120.f;
+    const float hudBarHeight = 15.f;
+    const float barX = hudX + 180.f;
+
+    // Libellé et valeur de chaque ligne, puis le niveau
+    constexpr std::size_t hudTextCount = 7;
+    const bool created = hudTexts.size() == hudTextCount;
+    if (!created)
+        hudTexts.assign(hudTextCount, sf::Text("", FontService::getFont(), 38));
+
+    hudBars.clear();
+    std::size_t textIndex = 0;
+
+    // Libellé fixe : écrit à la création seulement
+    auto addText = [&](const char* str, const sf::Color& color, float x, float y) {
+        sf::Text &text = hudTexts[textIndex++];
+        if (!created)
+            text.setString(str);
+        text.setFillColor(color);
+        text.setPosition(x, y);
+    };
+    // Texte d'une valeur, reformaté seulement si elle a changé depuis la dernière construction
+    auto addValue = [&](int value, int maxValue, int previousValue, int previousMax, float x, float y) {
+        sf::Text &text = hudTexts[textIndex++];
+        if (!created || !hudValid || value != previousValue || maxValue != previousMax)
+            text.setString(std::to_string(value) + "/" + std::to_string(maxValue));
+        text.setFillColor(sf::Color::White);
+        text.setPosition(x, y);
+    };
+    auto addBar = [&](float y, int value, int maxValue, const sf::Color& background, const sf::Color& fill) {
+        sf::FloatRect area(barX, y, hudBarWidth, hudBarHeight);
+        appendRect(hudBars, area, background);
+        if (maxValue > 0)
+        {
+            float ratio = static_cast<float>(value) / static_cast<float>(maxValue);
+            appendRect(hudBars, sf::FloatRect(barX, y, hudBarWidth * ratio, hudBarHeight), fill);
+        }
+        appendOutline(hudBars, area, 1.5f, sf::Color::White);
+    };
 
-    // --- Mana Text ---
-    sf::Text manaText;
-    manaText.setFont(font);
-    manaText.setCharacterSize(38);
-    manaText.setFillColor(sf::Color::White);
-    {
-        std::stringstream ss;
-        ss << player.getMana() << "/" << player.getMaxMana();
-        manaText.setString(ss.str());
-    }
-    manaText.setPosition(hudX + 320.f, hudY);
-    window.draw(manaText);
+    // --- HP ---
+    addText("HP", sf::Color::White, hudX, hudY);
+    addBar(hudY + 15.f, snapshot.hp, snapshot.maxHp, sf::Color::Red, sf::Color::Green);
+    addValue(snapshot.hp, snapshot.maxHp, hudSnapshot.hp, hudSnapshot.maxHp, hudX + 320.f, hudY);
 
-    // --- Endurance Bar ---
+    // --- Mana ---
     hudY += lineHeight;
-    sf::Text enduranceLabel;
-    enduranceLabel.setFont(font);
-    enduranceLabel.setString("Stamina");
-    enduranceLabel.setCharacterSize(38);
-    enduranceLabel.setFillColor(sf::Color::Yellow);
-    enduranceLabel.setPosition(hudX, hudY);
-    window.draw(enduranceLabel);
-
-    // Draw endurance bar (yellow color)
-    sf::RectangleShape enduranceBackgroundBar(sf::Vector2f(hudBarWidth, hudBarHeight));
-    enduranceBackgroundBar.setPosition(hudX + 180.f, hudY + 15.f);
-    enduranceBackgroundBar.setFillColor(sf::Color::Black);
-    window.draw(enduranceBackgroundBar);
+    addText("Mana", sf::Color::Cyan, hudX, hudY);
+    addBar(hudY + 15.f, snapshot.mana, snapshot.maxMana, sf::Color::Blue, sf::Color::Cyan);
+    addValue(snapshot.mana, snapshot.maxMana, hudSnapshot.mana, hudSnapshot.maxMana, hudX + 320.f, hudY);
 
-    if (player.getMaxEndurance() > 0)
-    {
-        float enduranceRatio = static_cast<float>(player.getEndurance()) / static_cast<float>(player.getMaxEndurance());
-        float filledWidth = hudBarWidth * enduranceRatio;
-
-        sf::RectangleShape enduranceBar(sf::Vector2f(filledWidth, hudBarHeight));
-        enduranceBar.setPosition(hudX + 180.f, hudY + 15.f);
-        enduranceBar.setFillColor(sf::Color::Yellow);
-        window.draw(enduranceBar);
-    }
-
-    sf::RectangleShape enduranceBorder(sf::Vector2f(hudBarWidth, hudBarHeight));
-    enduranceBorder.setPosition(hudX + 180.f, hudY + 15.f);
-    enduranceBorder.setFillColor(sf::Color::Transparent);
-    enduranceBorder.setOutlineColor(sf::Color::White);
-    enduranceBorder.setOutlineThickness(1.5f);
-    window.draw(enduranceBorder);
-
-    // --- Endurance Text ---
-    sf::Text enduranceText;
-    enduranceText.setFont(font);
-    enduranceText.setCharacterSize(38);
-    enduranceText.setFillColor(sf::Color::White);
-    {
-        std::stringstream ss;
-        ss << player.getEndurance() << "/" << player.getMaxEndurance();
-        enduranceText.setString(ss.str());
-    }
-    enduranceText.setPosition(hudX + 320.f, hudY);
-    window.draw(enduranceText);
+    // --- Endurance ---
+    hudY += lineHeight;
+    addText("Stamina", sf::Color::Yellow, hudX, hudY);
+    addBar(hudY + 15.f, snapshot.endurance, snapshot.maxEndurance, sf::Color::Black, sf::Color::Yellow);
+    addValue(snapshot.endurance, snapshot.maxEndurance, hudSnapshot.endurance, hudSnapshot.maxEndurance, hudX + 320.f, hudY);
 
     // --- Level ---
     hudY += lineHeight;
-    sf::Text levelLabel;
-    levelLabel.setFont(font);
-    levelLabel.setCharacterSize(38);
-    levelLabel.setFillColor(sf::Color::Magenta);
-    {
-        std::stringstream ss;
-        ss << "Level " << currentLevel;
-        levelLabel.setString(ss.str());
-    }
-    levelLabel.setPosition(hudX, hudY);
-    window.draw(levelLabel);
+    sf::Text &levelText = hudTexts[textIndex++];
+    if (!created || !hudValid || snapshot.level != hudSnapshot.level)
+        levelText.setString("Level " + std::to_string(snapshot.level));
+    levelText.setFillColor(sf::Color::Magenta);
+    levelText.setPosition(hudX, hudY);
+}
 
-    // Restore view
-    window.setView(currentView);
-}
\ No newline at end of file
+void UIManager::appendRect(sf::VertexArray& vertices, const sf::FloatRect& area, const sf::Color& color)
+{
+    if (area.width <= 0.f || area.height <= 0.f)
+        return;
+    vertices.append(sf::Vertex(sf::Vector2f(area.left, area.top), color));
+    vertices.append(sf::Vertex(sf::Vector2f(area.left + area.width, area.top), color));
+    vertices.append(sf::Vertex(sf::Vector2f(area.left + area.width, area.top + area.height), color));
+    vertices.append(sf::Vertex(sf::Vector2f(area.left, area.top + area.height), color));
+}
+
+void UIManager::appendOutline(sf::VertexArray& vertices, const sf::FloatRect& area, float thickness, const sf::Color& color)
+{
+    // Contour extérieur, comme sf::Shape::setOutlineThickness
+    const float l = area.left - thickness;
+    const float t = area.top - thickness;
+    const float w = area.width + 2.f * thickness;
+    const float h = area.height + 2.f * thickness;
+    appendRect(vertices, sf::FloatRect(l, t, w, thickness), color);
+    appendRect(vertices, sf::FloatRect(l, area.top + area.height, w, thickness), color);
+    appendRect(vertices, sf::FloatRect(l, area.top, thickness, area.height), color);
+    appendRect(vertices, sf::FloatRect(area.left + area.width, area.top, thickness, area.height), color);
+}
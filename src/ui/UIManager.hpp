@@ -1,5 +1,6 @@
 #include "InventoryMenu.hpp"
 #pragma once
+#include "UIViews.hpp"
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
@@ -13,16 +14,15 @@ public:
     UIManager();
 
     // Inventaire
-    void drawInventoryMenu(sf::RenderWindow& window, const GameCharacter& character);
+    void drawInventoryMenu(sf::RenderWindow& window, const InventoryView& view);
     InventoryMenu& getInventoryMenu();
 
     /**
-     * @brief Dessine les barres de vie pour tous les personnages (sauf le joueur)
-     * @param window La fenêtre de rendu
-     * @param allCharacters Liste de tous les personnages
-     * @param playerPtr Pointeur vers le joueur (pour l'exclure de l'affichage de barre)
+     * @brief Dessine les barres de vie des personnages visibles (le joueur n'en fait pas partie)
+     * @param target La cible de rendu (la scène du monde)
+     * @param bars Barres recopiées depuis la simulation
      */
-    void drawHealthBars(sf::RenderWindow& window, const std::vector<GameCharacter*>& allCharacters, GameCharacter* playerPtr);
+    void drawHealthBars(sf::RenderTarget& target, const std::vector<HealthBarView>& bars);
 
     /**
      * @brief Dessine la barre de vie du joueur en bas à gauche
@@ -41,10 +41,9 @@ public:
     /**
      * @brief Dessine le HUD complet du joueur en bas à gauche (HP, Mana, Endurance, Niveau)
      * @param window La fenêtre de rendu
-     * @param player Le joueur
-     * @param currentLevel Le niveau actuel
+     * @param hud Les valeurs du joueur et le niveau actuel
      */
-    void drawPlayerHUD(sf::RenderWindow& window, const GameCharacter& player, int currentLevel);
+    void drawPlayerHUD(sf::RenderWindow& window, const HudView& hud);
 
     // --- Notifications éphémères ---
     // Ajoute une notification à afficher (droite de l'écran)
@@ -53,16 +52,56 @@ public:
     void updateNotifications(float deltaTime);
     // Dessine les notifications à l'écran (vue par défaut)
     void drawNotifications(sf::RenderWindow& window);
+    // Recopie les textes des notifications actives (vers l'instantané de rendu)
+    void getNotificationTexts(std::vector<std::string>& texts) const;
+    // Remplace les notifications affichées par celles d'un instantané (côté rendu)
+    void setNotificationTexts(const std::vector<std::string>& texts);
 
 private:
-    sf::Font font;
     bool fontLoaded = false;
 
+    // --- HUD retenu : reconstruit seulement quand une valeur affichée change ---
+    struct HudSnapshot
+    {
+        int hp, maxHp, mana, maxMana, endurance, maxEndurance, level;
+        unsigned windowHeight;
+        bool operator==(const HudSnapshot& o) const
+        {
+            return hp == o.hp && maxHp == o.maxHp && mana == o.mana && maxMana == o.maxMana &&
+                   endurance == o.endurance && maxEndurance == o.maxEndurance && level == o.level &&
+                   windowHeight == o.windowHeight;
+        }
+    };
+    HudSnapshot hudSnapshot{};
+    bool hudValid = false;
+    sf::VertexArray hudBars{sf::Quads};
+    std::vector<sf::Text> hudTexts; // créés une fois ; seuls les textes des valeurs modifiées sont refaits
+    void rebuildHud(const HudSnapshot& snapshot);
+
+    // Barres de vie des PNJ visibles : un seul tableau de quads, capacité gardée d'une frame à l'autre
+    sf::VertexArray healthBarVertices{sf::Quads};
+
+    sf::Text playerHpText;
+    sf::Vector2i playerHpKey;
+    bool playerHpValid = false;
+    sf::Text playerManaText;
+    sf::Vector2i playerManaKey;
+    bool playerManaValid = false;
+
+    static void appendRect(sf::VertexArray& vertices, const sf::FloatRect& area, const sf::Color& color);
+    static void appendOutline(sf::VertexArray& vertices, const sf::FloatRect& area, float thickness, const sf::Color& color);
+
     InventoryMenu inventoryMenu;
 
     // Structure interne pour les notifications
     struct Notification { std::string text; float ttl; };
     std::vector<Notification> notifications;
+    // Géométrie des notifications, refaite seulement quand la liste change
+    sf::VertexArray notificationBoxes{sf::Quads};
+    std::vector<sf::Text> notificationTexts;
+    bool notificationsDirty = true;
+    unsigned notificationLayoutWidth = 0;
+    void rebuildNotifications(unsigned windowWidth);
     static constexpr float notificationWidth = 500.f;
     static constexpr float notificationMargin = 20.f;
 
@@ -72,12 +111,12 @@ private:
     static constexpr float barOffsetY = -15.f; // Au-dessus de la tête
 
     /**
-     * @brief Dessine une barre de vie à une position donnée
-     * @param window La fenêtre de rendu
+     * @brief Ajoute les quads d'une barre de vie (fond, remplissage, contour) à une position donnée
+     * @param vertices Le tableau de quads à compléter
      * @param x Position X
      * @param y Position Y
      * @param currentHP Points de vie actuels
      * @param maxHP Points de vie maximum
      */
-    void drawHealthBar(sf::RenderWindow& window, float x, float y, int currentHP, int maxHP);
+    static void appendHealthBar(sf::VertexArray& vertices, float x, float y, int currentHP, int maxHP);
 };
@@ -1,16 +1,44 @@
 #include "UIManager.hpp"
+#include "../resources/FontService.hpp"
 #include <algorithm>
 
 void UIManager::addNotification(const std::string &text, float duration)
 {
     notifications.push_back({text, duration});
+    notificationsDirty = true;
 }
 
 void UIManager::updateNotifications(float deltaTime)
 {
     for (auto &n : notifications)
         n.ttl -= deltaTime;
-    notifications.erase(std::remove_if(notifications.begin(), notifications.end(), [](const Notification &n){ return n.ttl <= 0.f; }), notifications.end());
+    auto expired = std::remove_if(notifications.begin(), notifications.end(), [](const Notification &n){ return n.ttl <= 0.f; });
+    if (expired != notifications.end())
+    {
+        notifications.erase(expired, notifications.end());
+        notificationsDirty = true;
+    }
+}
+
+void UIManager::getNotificationTexts(std::vector<std::string> &texts) const
+{
+    texts.resize(notifications.size());
+    for (size_t i = 0; i < notifications.size(); ++i)
+        texts[i].assign(notifications[i].text);
+}
+
+void UIManager::setNotificationTexts(const std::vector<std::string> &texts)
+{
+    bool same = texts.size() == notifications.size();
+    for (size_t i = 0; same && i < texts.size(); ++i)
+        same = texts[i] == notifications[i].text;
+    if (same)
+        return;
+
+    notifications.resize(texts.size());
+    for (size_t i = 0; i < texts.size(); ++i)
+        notifications[i] = {texts[i], 0.f};
+    notificationsDirty = true;
 }
 
 void UIManager::drawNotifications(sf::RenderWindow& window)
@@ -18,32 +46,47 @@ void UIManager::drawNotifications(sf::RenderWindow& window)
     if (!fontLoaded || notifications.empty())
         return;
 
+    if (notificationsDirty || notificationLayoutWidth != window.getSize().x)
+        rebuildNotifications(window.getSize().x);
+
     sf::View currentView = window.getView();
     window.setView(window.getDefaultView());
 
-    float x = window.getSize().x - notificationMargin - notificationWidth;
+    window.draw(notificationBoxes);
+    for (const auto &text : notificationTexts)
+        window.draw(text);
+
+    window.setView(currentView);
+}
+
+/**
+ * @brief Recalcule les cadres (un tableau de quads) et les textes des notifications
+ */
+void UIManager::rebuildNotifications(unsigned windowWidth)
+{
+    float x = windowWidth - notificationMargin - notificationWidth;
     float y = notificationMargin;
     float padding = 10.f;
     float lineHeight = 32.f;
 
+    notificationBoxes.clear();
+    notificationTexts.clear();
     for (size_t i = 0; i < notifications.size(); ++i)
     {
         const Notification &n = notifications[i];
-        sf::RectangleShape bg(sf::Vector2f(notificationWidth, lineHeight));
-        bg.setPosition(x, y + i * (lineHeight + 8.f));
-        bg.setFillColor(sf::Color(0, 0, 0, 150));
-        bg.setOutlineColor(sf::Color::White);
-        bg.setOutlineThickness(1.f);
-        window.draw(bg);
+        sf::FloatRect box(x, y + i * (lineHeight + 8.f), notificationWidth, lineHeight);
+        appendRect(notificationBoxes, box, sf::Color(0, 0, 0, 150));
+        appendOutline(notificationBoxes, box, 1.f, sf::Color::White);
 
         sf::Text text;
-        text.setFont(font);
+        text.setFont(FontService::getFont());
         text.setString(n.text);
         text.setCharacterSize(20);
         text.setFillColor(sf::Color::White);
-        text.setPosition(x + padding, y + i * (lineHeight + 8.f) + 4.f);
-        window.draw(text);
+        text.setPosition(x + padding, box.top + 4.f);
+        notificationTexts.push_back(text);
     }
 
-    window.setView(currentView);
-}
\ No newline at end of file
+    notificationLayoutWidth = windowWidth;
+    notificationsDirty = false;
+}
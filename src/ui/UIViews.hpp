@@ -0,0 +1,48 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <array>
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Valeurs affichées par le HUD du joueur (recopiées depuis la simulation à chaque tick)
+ */
+struct HudView
+{
+    int hp = 0;
+    int maxHp = 0;
+    int mana = 0;
+    int maxMana = 0;
+    int endurance = 0;
+    int maxEndurance = 0;
+    int level = 0;
+};
+
+/**
+ * @brief Barre de vie d'un personnage visible
+ */
+struct HealthBarView
+{
+    sf::Vector2f position; // position du personnage
+    float width = 0.f;     // largeur de sa hitbox (la barre est centrée dessus)
+    int hp = 0;
+    int maxHp = 0;
+};
+
+/**
+ * @brief Contenu de l'inventaire tel qu'affiché par InventoryMenu
+ */
+struct InventoryView
+{
+    static constexpr std::size_t slotCount = 10;
+
+    struct Slot
+    {
+        std::size_t count = 0;
+        std::string name;       // nom du type d'item de la pile
+        std::string spritePath; // sprite de l'item au sommet de la pile
+    };
+
+    std::array<Slot, slotCount> slots;
+    int selectedSlot = 0;
+};